@@ -1,6 +1,7 @@
 #include "CodeToolApp.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <fstream>
 #include <functional> 
@@ -8,6 +9,8 @@
 #include <locale>
 #include <sstream>
 #include <shlwapi.h>
+#include <thread>
+#include <unordered_map>
 #include <windows.h>
 #include <iostream>
 
@@ -47,6 +50,22 @@ float Timer::GetDeltaTime()
 	return res;
 }
 
+void RunWorkers(int tasksCount, const function<void()>& worker)
+{
+	int threadsCount = min(tasksCount, max(1, (int)thread::hardware_concurrency()));
+	if (threadsCount == 0)
+		return;
+
+	vector<thread> threads;
+	for (int i = 1; i < threadsCount; i++)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (auto& workerThread : threads)
+		workerThread.join();
+}
+
 CodeToolApplication::CodeToolApplication()
 {}
 
@@ -68,15 +87,21 @@ void CodeToolApplication::SetArguments(char** args, int nargs)
 
 void CodeToolApplication::Process()
 {
-	Timer t;
+	Timer t, phaseTimer;
 
 	LoadCache();
+	Log("Cache loaded for %.3f seconds\n", phaseTimer.GetDeltaTime());
+
 	UpdateCodeReflection();
+	phaseTimer.Reset();
+
 	SaveCache();
+	Log("Cache saved for %.3f seconds\n", phaseTimer.GetDeltaTime());
 
 	UpdateProjectFilesFilter();
+	Log("Project files updated for %.3f seconds\n", phaseTimer.GetDeltaTime());
 
-	Log("Code reflection generated for %.3f seconds", t.GetDeltaTime());
+	Log("Code reflection generated for %.3f seconds", t.GetTime());
 }
 
 bool CodeToolApplication::mVerbose = true;
@@ -257,15 +282,21 @@ string CodeToolApplication::GetRelativePath(const string& from, const string& to
 
 void CodeToolApplication::LoadCache()
 {
-	if (mNeedReset)
+	string cachePath = mSourcesPath + "/" + mCachePath;
+	bool isCacheActual = mCache.IsActual(cachePath);
+
+	if (mNeedReset || !isCacheActual)
 	{
+		if (!mNeedReset)
+			Log("Cache is missing or has other format version, all sources will be parsed again\n");
+
 		for (auto& file : mCache.parentProjects)
 			mCache.Load(file, false);
 
 		return;
 	}
 
-	mCache.Load(mSourcesPath + "/" + mCachePath);
+	mCache.Load(cachePath);
 }
 
 void CodeToolApplication::SaveCache()
@@ -505,69 +536,118 @@ void CodeToolApplication::UpdateProjectFilesFilter()
 
 void CodeToolApplication::UpdateCodeReflection()
 {
-	mParser = new CppSyntaxParser();
+	Timer t;
 
 	// get all files in sources path
 	mSourceFiles = GetFolderFiles(mSourcesPath);
+	Log("Sources list collected for %.3f seconds\n", t.GetDeltaTime());
 
-	// parse all headers
-	for (auto fileInfo : mSourceFiles)
-	{
-		if (!EndsWith(fileInfo.first, ".h"))
-			continue;
-
-		ParseSource(fileInfo.first, fileInfo.second);
-	}
+	// parse changed headers
+	ParseSources();
+	Log("Parsed %i headers for %.3f seconds\n", (int)mParsedFiles.size(), t.GetDeltaTime());
 
 	// remove old sources from cache
 	for (auto parseFileInfo = mCache.originalFiles.begin(); parseFileInfo != mCache.originalFiles.end();)
 	{
-		auto fnd = find_if(mSourceFiles.begin(), mSourceFiles.end(), [&](auto x) { return x.first == (*parseFileInfo)->GetPath(); });
-		if (fnd == mSourceFiles.end())
+		if (mSourceFiles.find((*parseFileInfo)->GetPath()) == mSourceFiles.end())
 		{
+			mCache.removedFiles.push_back((*parseFileInfo)->GetPath());
+			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), *parseFileInfo));
 			delete *parseFileInfo;
 			parseFileInfo = mCache.originalFiles.erase(parseFileInfo);
-			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), *parseFileInfo));
 		}
 		else ++parseFileInfo;
 	}
 
 	mCache.UpdateGlobalNamespace();
+	Log("Global namespace updated for %.3f seconds\n", t.GetDeltaTime());
 
 	// update reflection
 	for (auto file : mParsedFiles)
 		UpdateSourceReflection(file);
 
-	delete mParser;
+	Log("Reflection updated for %.3f seconds\n", t.GetDeltaTime());
 }
 
-void CodeToolApplication::ParseSource(const string& path, const TimeStamp& editDate)
+void CodeToolApplication::ParseSources()
 {
-	// check edit date
-	for (auto cacheFile : mCache.originalFiles)
+	struct ParseTask
 	{
-		if (path == cacheFile->GetPath())
-		{
-			if (editDate == cacheFile->GetLastEditedDate())
-				return;
+		string      path;
+		TimeStamp   editDate;
+		SyntaxFile* cachedFile = nullptr; // Previous file parsing result from cache
+		SyntaxFile* parsedFile = nullptr; // New parsing result, null when data wasn't changed
+	};
 
-			delete cacheFile;
-			mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), cacheFile));
-			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), cacheFile));
+	unordered_map<string, SyntaxFile*> cachedFiles;
+	for (auto file : mCache.originalFiles)
+		cachedFiles[file->GetPath()] = file;
 
-			break;
+	// check edit dates
+	vector<ParseTask> tasks;
+	for (auto& fileInfo : mSourceFiles)
+	{
+		if (!EndsWith(fileInfo.first, ".h"))
+			continue;
+
+		ParseTask task;
+		task.path = fileInfo.first;
+		task.editDate = fileInfo.second;
+
+		auto fnd = cachedFiles.find(fileInfo.first);
+		if (fnd != cachedFiles.end())
+		{
+			if (fnd->second->GetLastEditedDate() == fileInfo.second)
+				continue;
+
+			task.cachedFile = fnd->second;
 		}
+
+		tasks.push_back(task);
 	}
 
-	// parse source
-	SyntaxFile* syntaxFile = new SyntaxFile();
-	mParser->ParseFile(*syntaxFile, path, editDate);
-	mParsedFiles.push_back(syntaxFile);
+	// read and parse files. Each thread uses own parser, cache is changed only after all threads finished
+	atomic<int> nextTask(0);
+	RunWorkers((int)tasks.size(), [&]() {
+		CppSyntaxParser parser;
+		for (int i = nextTask++; i < (int)tasks.size(); i = nextTask++)
+		{
+			ParseTask& task = tasks[i];
+			string data = ReadFile(task.path);
+
+			if (task.cachedFile && task.cachedFile->GetDataHash() == GetDataHash(data))
+				continue;
+
+			task.parsedFile = new SyntaxFile();
+			parser.ParseFile(*task.parsedFile, task.path, task.editDate, data);
+		}
+	});
+
+	// update cache
+	for (auto& task : tasks)
+	{
+		if (!task.parsedFile)
+		{
+			task.cachedFile->mLastEditedDate = task.editDate;
+			task.cachedFile->mCacheChanged = true;
+
+			VerboseLog("Not changed %s\n", task.path.c_str());
+			continue;
+		}
+
+		if (task.cachedFile)
+		{
+			mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), task.cachedFile));
+			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), task.cachedFile));
+			delete task.cachedFile;
+		}
 
-	mCache.originalFiles.push_back(syntaxFile);
-	mCache.files.push_back(syntaxFile);
+		mParsedFiles.push_back(task.parsedFile);
+		mCache.originalFiles.push_back(task.parsedFile);
+		mCache.files.push_back(task.parsedFile);
 
-	VerboseLog("Parsed %s\n", path.c_str());
+		VerboseLog("Parsed %s\n", task.path.c_str());
+	}
 }
 
 void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
@@ -607,6 +687,7 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
 				RemoveMetas(cppSource, "CLASS_FIELDS_META(", "END_META;");
 				RemoveMetas(cppSource, "CLASS_METHODS_META(", "END_META;");
 				RemoveMetas(cppSource, "DECLARE_CLASS(", ");", false);
+				RemoveMetas(cppSource, "CLASS_SERIALIZATION_META(", "END_META;");
 				RemoveMetas(cppSource, "PRE_ENUM_META(", ");", false);
 			}
 			else cppSource = "#include \"" + GetPathWithoutDirectories(file->GetPath()) + "\"\n\n";
@@ -654,6 +735,14 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
 		{
 			checkCppLoad();
 			cppSource += GetClassDeclaration(cls);
+
+			bool isSerializable = std::find_if(cls->GetFunctions().begin(), cls->GetFunctions().end(),
+											   [](SyntaxFunction* x) {
+				return x->GetName() == "SERIALIZABLE" || x->GetName() == "ASSET_TYPE";
+			}) != cls->GetFunctions().end();
+
+			if (isSerializable)
+				cppSource += GetClassSerializationMeta(cls);
 		}
 		
 		hSource += GetClassMeta(cls);
@@ -669,6 +758,7 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
 	{
 		WriteFile(file->GetPath(), hSource);
 		file->mLastEditedDate = GetFileEditedDate(file->GetPath());
+		file->mDataHash = GetDataHash(hSource);
 	}
 
 	VerboseLog("Reflection generated for %s\n", file->GetPath().c_str());
@@ -688,6 +778,75 @@ string CodeToolApplication::GetClassDeclaration(SyntaxClass* cls)
 	return res;
 }
 
+string CodeToolApplication::GetClassSerializationMeta(SyntaxClass* cls)
+{
+	string res;
+
+	string nspace;
+	int nspaceDelimer = (int)cls->GetFullName().rfind("::");
+	if (nspaceDelimer != cls->GetFullName().npos)
+		nspace = cls->GetFullName().substr(0, nspaceDelimer);
+
+	res += "CLASS_SERIALIZATION_META(" + GetClassNormalizedTemplates(cls->GetFullName(), nspace) + ")\n{\n";
+
+	for (auto x : cls->GetVariables())
+	{
+		if (x->IsStatic())
+			continue;
+
+		SyntaxComment* synComment = cls->FindCommentNearLine(x->GetLine());
+		if (synComment && synComment->GetData().find("@IGNORE") != string::npos)
+			continue;
+
+		if (!IsVariableSerializable(x, cls))
+			continue;
+
+		if (!x->GetDefaultValue().empty() && x->GetDefaultValue().find("this") == string::npos)
+			res += "\tSERIALIZABLE_FIELD_DEFAULT(" + x->GetName() + ", " + x->GetDefaultValue() + ");\n";
+		else
+			res += "\tSERIALIZABLE_FIELD(" + x->GetName() + ");\n";
+	}
+
+	res += "}\nEND_META;\n";
+
+	return res;
+}
+
+bool CodeToolApplication::IsVariableSerializable(SyntaxVariable* variable, SyntaxClass* cls)
+{
+	static const string serializableAttributeName = "o2::SerializableAttribute";
+
+	// try attributes section
+	for (auto attr : cls->GetAttributes())
+	{
+		if (attr->GetLine() != variable->GetLine() - 1)
+			continue;
+
+		for (auto& attributeEntry : attr->GetAttributesList())
+		{
+			SyntaxClass* attributeClass = dynamic_cast<SyntaxClass*>(mCache.FindSection(attributeEntry, cls));
+			if (attributeClass && attributeClass->GetFullName() == serializableAttributeName)
+				return true;
+		}
+	}
+
+	// try comment
+	SyntaxComment* synComment = cls->FindCommentNearLine(variable->GetLine());
+	if (!synComment)
+		return false;
+
+	for (auto attributeClass : mCache.attributes)
+	{
+		if (attributeClass->GetFullName() != serializableAttributeName || attributeClass->GetAttributeCommentDef().empty())
+			continue;
+
+		if (synComment->GetData().find(attributeClass->GetAttributeCommentDef()) != string::npos)
+			return true;
+	}
+
+	return false;
+}
+
 string CodeToolApplication::GetClassMeta(SyntaxClass* cls)
 {
 	string res = "\n";
@@ -1274,11 +1433,32 @@ void CodeToolCache::SearchAttributes(SyntaxSection* section, SyntaxClass* attrib
 
 void CodeToolCache::Save(const string& file) const
 {
+	string filesCacheDirectory = GetFilesCacheDirectory(file);
+	CreateDirectoryA(filesCacheDirectory.c_str(), NULL);
+
+	for (auto& removedFile : removedFiles)
+		DeleteFileA((filesCacheDirectory + "/" + GetFileCacheName(file, removedFile)).c_str());
+
 	pugi::xml_document doc;
 
 	pugi::xml_node filesNode = doc.append_child("files");
-	for (auto file : originalFiles)
-		file->SaveTo(filesNode.append_child("file"));
+	filesNode.append_attribute("version") = formatVersion;
+
+	for (auto syntaxFile : originalFiles)
+	{
+		string cacheName = GetFileCacheName(file, syntaxFile->GetPath());
+
+		pugi::xml_node fileNode = filesNode.append_child("file");
+		fileNode.append_attribute("path") = syntaxFile->GetPath().c_str();
+		fileNode.append_attribute("cache") = cacheName.c_str();
+
+		if (!syntaxFile->mCacheChanged)
+			continue;
+
+		pugi::xml_document fileDoc;
+		syntaxFile->SaveTo(fileDoc.append_child("file"));
+		fileDoc.save_file((filesCacheDirectory + "/" + cacheName).c_str());
+	}
 
 	pugi::xml_node parentProjsNode = doc.append_child("parentProjects");
 	for (auto& proj : parentProjects)
@@ -1292,11 +1472,47 @@ void CodeToolCache::Load(const string& file, bool original /*= true*/)
 	pugi::xml_document doc;
 	doc.load_file(file.c_str());
 
+	string filesCacheDirectory = GetFilesCacheDirectory(file);
+
+	vector<pugi::xml_node> filesNodes;
 	pugi::xml_node filesNode = doc.child("files");
 	for (auto x : filesNode)
+		filesNodes.push_back(x);
+
+	// syntax files are loaded from separate files in parallel. Old caches contains syntax files inside
+	vector<SyntaxFile*> loadedFiles(filesNodes.size(), nullptr);
+	atomic<int> nextFile(0);
+	RunWorkers((int)filesNodes.size(), [&]() {
+		for (int i = nextFile++; i < (int)filesNodes.size(); i = nextFile++)
+		{
+			SyntaxFile* newFile = new SyntaxFile();
+
+			pugi::xml_attribute cacheAttribute = filesNodes[i].attribute("cache");
+			if (cacheAttribute)
+			{
+				// File without loaded syntax isn't cached: original source is parsed again as new one
+				pugi::xml_document fileDoc;
+				if (!fileDoc.load_file((filesCacheDirectory + "/" + cacheAttribute.as_string()).c_str()))
+				{
+					delete newFile;
+					continue;
+				}
+
+				newFile->LoadFrom(fileDoc.child("file"));
+				newFile->mCacheChanged = false;
+			}
+			else
+				newFile->LoadFrom(filesNodes[i]);
+
+			loadedFiles[i] = newFile;
+		}
+	});
+
+	for (auto newFile : loadedFiles)
 	{
-		SyntaxFile* newFile = new SyntaxFile();
-		newFile->LoadFrom(x);
+		if (!newFile)
+			continue;
+
 		files.push_back(newFile);
 
 		if (original)
@@ -1320,6 +1536,51 @@ void CodeToolCache::Load(const string& file, bool original /*= true*/)
 	}
 }
 
+bool CodeToolCache::IsActual(const string& file) const
+{
+	pugi::xml_document doc;
+	if (!doc.load_file(file.c_str()))
+		return false;
+
+	return doc.child("files").attribute("version").as_int() == formatVersion;
+}
+
+string CodeToolCache::GetFilesCacheDirectory(const string& file) const
+{
+	auto dotPos = file.rfind('.');
+	auto slashPos = file.find_last_of("/\\");
+	if (dotPos == string::npos || (slashPos != string::npos && dotPos < slashPos))
+		return file + "_files";
+
+	return file.substr(0, dotPos);
+}
+
+string CodeToolCache::GetFileCacheName(const string& file, const string& sourcePath) const
+{
+	// source file name with hash of path relative to cache file directory, different paths can't share cache
+	string relativePath = sourcePath;
+
+	auto slashPos = file.find_last_of("/\\");
+	if (slashPos != string::npos && relativePath.compare(0, slashPos + 1, file, 0, slashPos + 1) == 0)
+		relativePath.erase(0, slashPos + 1);
+
+	for (auto& c : relativePath)
+	{
+		if (c == '\\')
+			c = '/';
+	}
+
+	string name = relativePath;
+	auto nameSlashPos = name.find_last_of("/:");
+	if (nameSlashPos != string::npos)
+		name.erase(0, nameSlashPos + 1);
+
+	char hash[32];
+	snprintf(hash, sizeof(hash), "%016llx", GetDataHash(relativePath));
+
+	return name + "_" + hash + ".xml";
+}
+
 void CodeToolCache::AppendSection(SyntaxSection* currentSection, SyntaxSection* newSection)
 {
 	if (newSection->IsClass())
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <windows.h>
+#include <functional>
 #include "CppSyntaxParser.h"
 
+// Runs worker function in threads by cores count, but not more than tasks count. Worker takes tasks by itself
+void RunWorkers(int tasksCount, const function<void()>& worker);
+
 class Timer
 {
 public:
@@ -27,11 +31,16 @@ protected:
 class CodeToolCache
 {
 public:
+	// Cache format version. Must be increased when syntax cache or generated reflection format is changed,
+	// caches with other version are reset and all sources are parsed and generated again
+	static const int formatVersion = 3;
+
 	SyntaxFilesVec   files;           // All syntax files list, including parent projects
 	SyntaxFilesVec   originalFiles;   // Original syntax files list
 	SyntaxSection    globalNamespace; // Global syntax namespace
 	SyntaxClassesVec attributes;      // Allattribute classes
 	vector<string>   parentProjects;  // Parent projects code tool caches, that used in current project
+	vector<string>   removedFiles;    // Removed source files paths, their caches are deleted on saving
 
 	// Updates global namespace
 	void UpdateGlobalNamespace();
@@ -48,18 +57,23 @@ public:
 	// Returns section by name in where
 	SyntaxSection* FindSection(const string& what, SyntaxSection* where);
 
-	// Saves data to file
+	// Saves files list to file and each changed syntax file into separate file in caches directory
 	void Save(const string& file) const;
 
 	// Loads data from file
 	void Load(const string& file, bool original = true);
 
+	// Returns is cache file exists and has actual format version
+	bool IsActual(const string& file) const;
+
 protected:
 	void AppendSection(SyntaxSection* currentSection, SyntaxSection* newSection);
 	void ResolveDependencies(SyntaxSection* section);
 	void ResolveBaseClassDependencies(SyntaxSection* section);
 	SyntaxSection* FindSection(const string& what, SyntaxSection* where, SyntaxSectionsVec& processedSections);
 	void SearchAttributes(SyntaxSection* section, SyntaxClass* attributeClass);
+	string GetFilesCacheDirectory(const string& file) const;
+	string GetFileCacheName(const string& file, const string& sourcePath) const;
 };
 
 // ---------------------
@@ -95,7 +109,6 @@ protected:
 	bool                   mNeedReset = true;
 	static bool            mVerbose;
 					       
-	CppSyntaxParser*       mParser;
 	vector<SyntaxFile*>    mParsedFiles;
 	CodeToolCache          mCache;
 	map<string, TimeStamp> mSourceFiles;
@@ -140,8 +153,8 @@ protected:
 	// Updates code reflection
 	void UpdateCodeReflection();
 
-	// Parses source file
-	void ParseSource(const string& path, const TimeStamp& editDate);
+	// Parses changed headers in parallel. Headers with changed edit date, but same data, aren't parsed
+	void ParseSources();
 
 	// Updates reflection for classes in source
 	void UpdateSourceReflection(SyntaxFile* file);
@@ -149,6 +162,12 @@ protected:
 	// Returns class declaration meta
 	string GetClassDeclaration(SyntaxClass* cls);
 
+	// Returns class generated serializable fields functions meta
+	string GetClassSerializationMeta(SyntaxClass* cls);
+
+	// Returns is variable marked with serializable attribute by comment or attributes section
+	bool IsVariableSerializable(SyntaxVariable* variable, SyntaxClass* cls);
+
 	// Returns class reflection meta
 	string GetClassMeta(SyntaxClass* cls);
 
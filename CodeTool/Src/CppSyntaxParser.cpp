@@ -92,6 +92,19 @@ vector<string> Split(const string &s, char delim)
 	return elems;
 }
 
+unsigned long long GetDataHash(const string& data)
+{
+	// FNV-1a
+	unsigned long long res = 14695981039346656037ull;
+	for (auto c : data)
+	{
+		res ^= (unsigned char)c;
+		res *= 1099511628211ull;
+	}
+
+	return res;
+}
+
 CppSyntaxParser::CppSyntaxParser()
 {
 	InitializeParsers();
@@ -148,10 +161,21 @@ void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const
 	if (!fin.is_open())
 		return;
 
-	file.mData = string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+	string data = string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
 
 	fin.close();
 
+	ParseFile(file, filePath, fileEditDate, data);
+}
+
+void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const TimeStamp& fileEditDate, 
+								const string& fileData)
+{
+	file.mPath = filePath;
+	file.mLastEditedDate = fileEditDate;
+	file.mData = fileData;
+	file.mDataHash = GetDataHash(fileData);
+
 	if (file.mData.find("@CODETOOLIGNORE") != string::npos)
 		return;
 
@@ -74,6 +74,9 @@ public:
 	// Returns file last edit date
 	const TimeStamp& GetLastEditedDate() const;
 
+	// Returns hash of file's data
+	unsigned long long GetDataHash() const;
+
 	// Returns global syntax namespace in this file
 	SyntaxNamespace* GetGlobalNamespace() const;
 
@@ -84,13 +87,16 @@ public:
 	void LoadFrom(pugi::xml_node& node);
 
 protected:
-	string           mPath;                      // File path
-	string           mData;                      // File data
-	TimeStamp        mLastEditedDate;            // Last file edited date
-	SyntaxNamespace* mGlobalNamespace = nullptr; // Global syntax namespace in file
+	string             mPath;                      // File path
+	string             mData;                      // File data
+	TimeStamp          mLastEditedDate;            // Last file edited date
+	unsigned long long mDataHash = 0;              // File data hash, used to skip parsing when only edit date was changed
+	SyntaxNamespace*   mGlobalNamespace = nullptr; // Global syntax namespace in file
+	bool               mCacheChanged = true;       // Is file changed since last cache saving
 
 	friend class CppSyntaxParser;
 	friend class CodeToolApplication;
+	friend class CodeToolCache;
 };
 
 // Syntax expression base
@@ -84,7 +84,19 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AnimationAddKeysAction);
+CLASS_SERIALIZATION_META(Editor::AnimationAddKeysAction)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::AnimationDeleteKeysAction);
+CLASS_SERIALIZATION_META(Editor::AnimationDeleteKeysAction)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::AnimationKeysChangeAction);
+CLASS_SERIALIZATION_META(Editor::AnimationKeysChangeAction)
+{
+}
+END_META;
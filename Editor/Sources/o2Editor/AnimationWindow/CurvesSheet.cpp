@@ -168,3 +168,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::CurvesSheet);
+CLASS_SERIALIZATION_META(Editor::CurvesSheet)
+{
+}
+END_META;
@@ -713,3 +713,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::KeyHandlesSheet);
+CLASS_SERIALIZATION_META(Editor::KeyHandlesSheet)
+{
+}
+END_META;
@@ -397,5 +397,13 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AnimationPropertiesTree);
+CLASS_SERIALIZATION_META(Editor::AnimationPropertiesTree)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::AnimationPropertiesTreeNode);
+CLASS_SERIALIZATION_META(Editor::AnimationPropertiesTreeNode)
+{
+}
+END_META;
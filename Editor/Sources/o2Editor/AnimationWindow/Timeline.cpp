@@ -438,3 +438,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AnimationTimeline);
+CLASS_SERIALIZATION_META(Editor::AnimationTimeline)
+{
+}
+END_META;
@@ -43,3 +43,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AnimationKeyDragHandle);
+CLASS_SERIALIZATION_META(Editor::AnimationKeyDragHandle)
+{
+}
+END_META;
@@ -61,3 +61,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::ITrackControl);
+CLASS_SERIALIZATION_META(Editor::ITrackControl)
+{
+}
+END_META;
@@ -238,3 +238,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::MapKeyFramesTrackControl);
+CLASS_SERIALIZATION_META(Editor::MapKeyFramesTrackControl)
+{
+}
+END_META;
@@ -487,5 +487,13 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AnimationTree);
+CLASS_SERIALIZATION_META(Editor::AnimationTree)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::AnimationTreeNode);
+CLASS_SERIALIZATION_META(Editor::AnimationTreeNode)
+{
+}
+END_META;
@@ -157,3 +157,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AssetIcon);
+CLASS_SERIALIZATION_META(Editor::AssetIcon)
+{
+}
+END_META;
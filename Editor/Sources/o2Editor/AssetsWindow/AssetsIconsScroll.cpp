@@ -1132,3 +1132,11 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AssetsIconsScrollArea);
+CLASS_SERIALIZATION_META(Editor::AssetsIconsScrollArea)
+{
+	SERIALIZABLE_FIELD(mHighlightAnim);
+	SERIALIZABLE_FIELD_DEFAULT(mHighlightSprite, nullptr);
+	SERIALIZABLE_FIELD(mHighlightLayout);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionSprite, nullptr);
+}
+END_META;
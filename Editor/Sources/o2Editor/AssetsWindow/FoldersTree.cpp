@@ -299,5 +299,13 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AssetsFoldersTree);
+CLASS_SERIALIZATION_META(Editor::AssetsFoldersTree)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::FoldersTree);
+CLASS_SERIALIZATION_META(Editor::FoldersTree)
+{
+}
+END_META;
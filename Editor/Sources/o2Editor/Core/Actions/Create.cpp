@@ -71,3 +71,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::CreateAction);
+CLASS_SERIALIZATION_META(Editor::CreateAction)
+{
+}
+END_META;
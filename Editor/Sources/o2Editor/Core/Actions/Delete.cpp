@@ -118,5 +118,17 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::DeleteAction);
+CLASS_SERIALIZATION_META(Editor::DeleteAction)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::DeleteAction::ObjectInfo);
+CLASS_SERIALIZATION_META(Editor::DeleteAction::ObjectInfo)
+{
+	SERIALIZABLE_FIELD(objectData);
+	SERIALIZABLE_FIELD(parentId);
+	SERIALIZABLE_FIELD(prevObjectId);
+	SERIALIZABLE_FIELD(idx);
+}
+END_META;
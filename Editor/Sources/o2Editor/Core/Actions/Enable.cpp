@@ -43,3 +43,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::EnableAction);
+CLASS_SERIALIZATION_META(Editor::EnableAction)
+{
+}
+END_META;
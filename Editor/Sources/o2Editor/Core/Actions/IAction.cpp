@@ -2,3 +2,7 @@
 #include "IAction.h"
 
 DECLARE_CLASS(Editor::IAction);
+CLASS_SERIALIZATION_META(Editor::IAction)
+{
+}
+END_META;
@@ -43,3 +43,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::LockAction);
+CLASS_SERIALIZATION_META(Editor::LockAction)
+{
+}
+END_META;
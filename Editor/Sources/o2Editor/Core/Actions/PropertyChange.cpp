@@ -95,3 +95,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::PropertyChangeAction);
+CLASS_SERIALIZATION_META(Editor::PropertyChangeAction)
+{
+}
+END_META;
@@ -121,3 +121,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::ReparentAction);
+CLASS_SERIALIZATION_META(Editor::ReparentAction)
+{
+}
+END_META;
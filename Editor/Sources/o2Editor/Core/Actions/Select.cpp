@@ -52,3 +52,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::SelectAction);
+CLASS_SERIALIZATION_META(Editor::SelectAction)
+{
+}
+END_META;
@@ -73,3 +73,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::TransformAction);
+CLASS_SERIALIZATION_META(Editor::TransformAction)
+{
+}
+END_META;
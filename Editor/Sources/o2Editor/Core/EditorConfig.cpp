@@ -85,7 +85,25 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::EditorConfig);
+CLASS_SERIALIZATION_META(Editor::EditorConfig)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::EditorConfig::GlobalConfig);
+CLASS_SERIALIZATION_META(Editor::EditorConfig::GlobalConfig)
+{
+	SERIALIZABLE_FIELD(mDefaultLayout);
+	SERIALIZABLE_FIELD(mAvailableLayouts);
+}
+END_META;
 
 DECLARE_CLASS(Editor::EditorConfig::ProjectConfig);
+CLASS_SERIALIZATION_META(Editor::EditorConfig::ProjectConfig)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mWindowSize, Vec2I(800, 600));
+	SERIALIZABLE_FIELD(mWindowPosition);
+	SERIALIZABLE_FIELD_DEFAULT(mMaximized, true);
+	SERIALIZABLE_FIELD(mLayout);
+}
+END_META;
@@ -85,3 +85,7 @@ namespace Editor
 DECLARE_CLASS_MANUAL(Editor::TPropertyField<o2::SceneLayersList>);
 
 DECLARE_CLASS(Editor::SceneLayersListProperty);
+CLASS_SERIALIZATION_META(Editor::SceneLayersListProperty)
+{
+}
+END_META;
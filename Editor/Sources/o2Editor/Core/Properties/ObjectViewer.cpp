@@ -82,3 +82,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::ObjectViewer);
+CLASS_SERIALIZATION_META(Editor::ObjectViewer)
+{
+}
+END_META;
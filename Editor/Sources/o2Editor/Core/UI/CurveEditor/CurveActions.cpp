@@ -275,7 +275,19 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::CurveAddKeysAction);
+CLASS_SERIALIZATION_META(Editor::CurveAddKeysAction)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::CurveDeleteKeysAction);
+CLASS_SERIALIZATION_META(Editor::CurveDeleteKeysAction)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::CurveKeysChangeAction);
+CLASS_SERIALIZATION_META(Editor::CurveKeysChangeAction)
+{
+}
+END_META;
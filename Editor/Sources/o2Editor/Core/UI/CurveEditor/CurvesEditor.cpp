@@ -2274,7 +2274,25 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::CurvesEditor);
+CLASS_SERIALIZATION_META(Editor::CurvesEditor)
+{
+	SERIALIZABLE_FIELD(mMainHandleSample);
+	SERIALIZABLE_FIELD(mSupportHandleSample);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionSprite, nullptr);
+	SERIALIZABLE_FIELD(mTextFont);
+}
+END_META;
 
 DECLARE_CLASS(Editor::CurvesEditor::CurveHandle);
+CLASS_SERIALIZATION_META(Editor::CurvesEditor::CurveHandle)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::CurvesEditor::CurveCopyInfo);
+CLASS_SERIALIZATION_META(Editor::CurvesEditor::CurveCopyInfo)
+{
+	SERIALIZABLE_FIELD(curveId);
+	SERIALIZABLE_FIELD(keys);
+}
+END_META;
@@ -146,3 +146,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::CurvePreview);
+CLASS_SERIALIZATION_META(Editor::CurvePreview)
+{
+}
+END_META;
@@ -193,3 +193,10 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::FrameScrollView);
+CLASS_SERIALIZATION_META(Editor::FrameScrollView)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mHorScrollbar, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mVerScrollbar, nullptr);
+	SERIALIZABLE_FIELD(mAvailableArea);
+}
+END_META;
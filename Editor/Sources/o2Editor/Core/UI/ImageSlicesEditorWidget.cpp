@@ -225,5 +225,13 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::ImageSlicesEditorWidget);
+CLASS_SERIALIZATION_META(Editor::ImageSlicesEditorWidget)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::ImageSlicesEditorWidget::PreviewImage);
+CLASS_SERIALIZATION_META(Editor::ImageSlicesEditorWidget::PreviewImage)
+{
+}
+END_META;
@@ -370,3 +370,9 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::ScrollView);
+CLASS_SERIALIZATION_META(Editor::ScrollView)
+{
+	SERIALIZABLE_FIELD(mBackColor);
+	SERIALIZABLE_FIELD(mGridColor);
+}
+END_META;
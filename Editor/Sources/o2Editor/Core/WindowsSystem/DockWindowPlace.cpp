@@ -263,3 +263,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::DockWindowPlace);
+CLASS_SERIALIZATION_META(Editor::DockWindowPlace)
+{
+}
+END_META;
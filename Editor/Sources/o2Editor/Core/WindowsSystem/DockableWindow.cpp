@@ -842,3 +842,8 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::DockableWindow);
+CLASS_SERIALIZATION_META(Editor::DockableWindow)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mDockingFrameSample, nullptr);
+}
+END_META;
@@ -168,5 +168,19 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::WindowsLayout);
+CLASS_SERIALIZATION_META(Editor::WindowsLayout)
+{
+	SERIALIZABLE_FIELD(mainDock);
+	SERIALIZABLE_FIELD(windows);
+}
+END_META;
 
 DECLARE_CLASS(Editor::WindowsLayout::WindowDockPlace);
+CLASS_SERIALIZATION_META(Editor::WindowsLayout::WindowDockPlace)
+{
+	SERIALIZABLE_FIELD(anchors);
+	SERIALIZABLE_FIELD(windows);
+	SERIALIZABLE_FIELD(active);
+	SERIALIZABLE_FIELD(childs);
+}
+END_META;
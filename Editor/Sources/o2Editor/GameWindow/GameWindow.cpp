@@ -197,5 +197,15 @@ namespace Editor
 DECLARE_CLASS(Editor::GameWindow);
 
 DECLARE_CLASS(Editor::GameWindow::GameView);
+CLASS_SERIALIZATION_META(Editor::GameWindow::GameView)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::GameWindow::SimulationDevice);
+CLASS_SERIALIZATION_META(Editor::GameWindow::SimulationDevice)
+{
+	SERIALIZABLE_FIELD(deviceName);
+	SERIALIZABLE_FIELD(resolution);
+}
+END_META;
@@ -344,7 +344,19 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::AddComponentPanel);
+CLASS_SERIALIZATION_META(Editor::AddComponentPanel)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::ComponentsTree);
+CLASS_SERIALIZATION_META(Editor::ComponentsTree)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::ComponentsTreeNode);
+CLASS_SERIALIZATION_META(Editor::ComponentsTreeNode)
+{
+}
+END_META;
@@ -375,5 +375,14 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::LayersPopup);
+CLASS_SERIALIZATION_META(Editor::LayersPopup)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mItemSample, nullptr);
+}
+END_META;
 
 DECLARE_CLASS(Editor::LayerPopupItem);
+CLASS_SERIALIZATION_META(Editor::LayerPopupItem)
+{
+}
+END_META;
@@ -76,3 +76,7 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::SceneDragHandle);
+CLASS_SERIALIZATION_META(Editor::SceneDragHandle)
+{
+}
+END_META;
@@ -269,8 +269,8 @@ namespace Editor
 
 				for (auto object : assetsScroll->mInstantiatedSceneDragObjects)
 				{
-					int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
-					CreateVisibleNodeWidget(mAllNodes[idx], idx);
+					Node* node = FindNode(object);
+					CreateVisibleNodeWidget(node, GetNodePosition(node));
 				}
 
 				Focus();
@@ -484,5 +484,13 @@ namespace Editor
 }
 
 DECLARE_CLASS(Editor::SceneTree);
+CLASS_SERIALIZATION_META(Editor::SceneTree)
+{
+}
+END_META;
 
 DECLARE_CLASS(Editor::SceneTreeNode);
+CLASS_SERIALIZATION_META(Editor::SceneTreeNode)
+{
+}
+END_META;
@@ -170,3 +170,10 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AnimationClip);
+CLASS_SERIALIZATION_META(o2::AnimationClip)
+{
+	SERIALIZABLE_FIELD(mTracks);
+	SERIALIZABLE_FIELD_DEFAULT(mDuration, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mLoop, Loop::None);
+}
+END_META;
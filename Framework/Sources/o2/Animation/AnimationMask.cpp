@@ -14,3 +14,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AnimationMask);
+CLASS_SERIALIZATION_META(o2::AnimationMask)
+{
+	SERIALIZABLE_FIELD(weights);
+}
+END_META;
@@ -93,7 +93,7 @@ namespace o2
 	void AnimationPlayer::BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack * track, bool errors)
 	{
 		const FieldInfo* fieldInfo = nullptr;
-		auto targetPtr = type->GetFieldPtr(castedTarget, track->path, fieldInfo);
+		auto targetPtr = track->GetTargetFieldPtr(type, castedTarget, fieldInfo);
 
 		if (!fieldInfo)
 		{
@@ -22,6 +22,17 @@ namespace o2
 		return mWeight;
 	}
 
+	void AnimationState::SetMask(const AnimationMask& mask)
+	{
+		this->mask = mask;
+		OnMaskChanged();
+	}
+
+	const AnimationMask& AnimationState::GetMask() const
+	{
+		return mask;
+	}
+
 	void AnimationState::SetAnimation(const AnimationAssetRef& animationAsset)
 	{
 		mAnimation = animationAsset;
@@ -38,6 +49,12 @@ namespace o2
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
+	void AnimationState::OnMaskChanged()
+	{
+		if (mOwner)
+			mOwner->OnStateMaskChanged(this);
+	}
+
 	void AnimationState::OnTrackPlayerAdded(IAnimationTrack::IPlayer* trackPlayer)
 	{
 		if (mOwner)
@@ -53,3 +70,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AnimationState);
+CLASS_SERIALIZATION_META(o2::AnimationState)
+{
+	SERIALIZABLE_FIELD(name);
+	SERIALIZABLE_FIELD(mask);
+	SERIALIZABLE_FIELD(mAnimation);
+	SERIALIZABLE_FIELD_DEFAULT(mWeight, 1.0f);
+}
+END_META;
@@ -18,7 +18,7 @@ namespace o2
 	{
 	public:
 		String        name; // State name @SERIALIZABLE
-		AnimationMask mask; // Animation mask @SERIALIZABLE
+		AnimationMask mask; // Animation mask. Call SetMask() or OnMaskChanged() after changing it to update owner's mixers @SERIALIZABLE @INVOKE_ON_CHANGE(OnMaskChanged)
 
 		float blend = 1.0f; // State blending coefficient in 0..1 Used for blending
 
@@ -37,6 +37,15 @@ namespace o2
 		// Returns state weight
 		float GetWeight() const;
 
+		// Sets animation mask, updates owner's mixers masks weights
+		void SetMask(const AnimationMask& mask);
+
+		// Returns animation mask
+		const AnimationMask& GetMask() const;
+
+		// It is called when mask changed, updates owner's mixers masks weights
+		void OnMaskChanged();
+
 		// Sets animation
 		void SetAnimation(const AnimationAssetRef& animationAsset);
 
@@ -76,7 +85,7 @@ END_META;
 CLASS_FIELDS_META(o2::AnimationState)
 {
 	PUBLIC_FIELD(name).SERIALIZABLE_ATTRIBUTE();
-	PUBLIC_FIELD(mask).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(mask).INVOKE_ON_CHANGE_ATTRIBUTE(OnMaskChanged).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(blend).DEFAULT_VALUE(1.0f);
 	PUBLIC_FIELD(player);
 	PROTECTED_FIELD(mOwner).DEFAULT_VALUE(nullptr);
@@ -89,6 +98,9 @@ CLASS_METHODS_META(o2::AnimationState)
 
 	PUBLIC_FUNCTION(void, SetWeight, float);
 	PUBLIC_FUNCTION(float, GetWeight);
+	PUBLIC_FUNCTION(void, SetMask, const AnimationMask&);
+	PUBLIC_FUNCTION(const AnimationMask&, GetMask);
+	PUBLIC_FUNCTION(void, OnMaskChanged);
 	PUBLIC_FUNCTION(void, SetAnimation, const AnimationAssetRef&);
 	PUBLIC_FUNCTION(const AnimationAssetRef&, GetAnimation);
 	PROTECTED_FUNCTION(void, OnAnimationChanged);
@@ -200,7 +200,12 @@ namespace o2
 
 	void IAnimation::SetPlaying(bool playing)
 	{
+		bool started = playing && !mPlaying;
 		mPlaying = playing;
+
+		if (started)
+			onPlayEvent();
+
 		Evaluate();
 	}
 
@@ -302,5 +302,10 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AnimationTrack<float>);
+CLASS_SERIALIZATION_META(o2::AnimationTrack<float>)
+{
+	SERIALIZABLE_FIELD(curve);
+}
+END_META;
 
 DECLARE_CLASS(o2::AnimationTrack<float>::Player);
@@ -619,3 +619,16 @@ DECLARE_CLASS(o2::AnimationTrack<o2::Vec2F>);
 DECLARE_CLASS(o2::AnimationTrack<o2::Vec2F>::Player);
 
 DECLARE_CLASS(o2::AnimationTrack<o2::Vec2F>::Key);
+CLASS_SERIALIZATION_META(o2::AnimationTrack<o2::Vec2F>::Key)
+{
+	SERIALIZABLE_FIELD(uid);
+	SERIALIZABLE_FIELD(position);
+	SERIALIZABLE_FIELD(value);
+	SERIALIZABLE_FIELD(prevSupportValue);
+	SERIALIZABLE_FIELD(nextSupportValue);
+	SERIALIZABLE_FIELD(leftSupportValue);
+	SERIALIZABLE_FIELD(leftSupportPosition);
+	SERIALIZABLE_FIELD(rightSupportValue);
+	SERIALIZABLE_FIELD(rightSupportPosition);
+}
+END_META;
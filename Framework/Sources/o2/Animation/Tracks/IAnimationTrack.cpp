@@ -100,8 +100,25 @@ namespace o2
 		return *this;
 	}
 
+	void* IAnimationTrack::GetTargetFieldPtr(const Type* type, void* target, const FieldInfo*& fieldInfo)
+	{
+		if (mTargetPath.GetResolvedType() != type || mTargetPath.GetPath() != path)
+		{
+			mTargetPath.SetPath(path);
+			mTargetPath.Resolve(type);
+		}
+
+		return mTargetPath.GetFieldPtr(target, fieldInfo);
+	}
+
 }
 
 DECLARE_CLASS(o2::IAnimationTrack);
+CLASS_SERIALIZATION_META(o2::IAnimationTrack)
+{
+	SERIALIZABLE_FIELD_DEFAULT(loop, Loop::None);
+	SERIALIZABLE_FIELD(path);
+}
+END_META;
 
 DECLARE_CLASS(o2::IAnimationTrack::IPlayer);
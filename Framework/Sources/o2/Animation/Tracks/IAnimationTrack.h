@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Reflection/FieldPath.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -79,7 +80,13 @@ namespace o2
 		// Creates track-type specific player
 		virtual IPlayer* CreatePlayer() const { return nullptr; }
 
+		// Returns animated property pointer in target. Path is resolved once for target type and reused for same type targets
+		void* GetTargetFieldPtr(const Type* type, void* target, const FieldInfo*& fieldInfo);
+
 		SERIALIZABLE(IAnimationTrack);
+
+	protected:
+		FieldPath mTargetPath; // Animated property path, resolved for last target type
 	};
 };
 
@@ -94,6 +101,7 @@ CLASS_FIELDS_META(o2::IAnimationTrack)
 	PUBLIC_FIELD(loop).DEFAULT_VALUE(Loop::None).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(path).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(onKeysChanged);
+	PROTECTED_FIELD(mTargetPath);
 }
 END_META;
 CLASS_METHODS_META(o2::IAnimationTrack)
@@ -103,6 +111,7 @@ CLASS_METHODS_META(o2::IAnimationTrack)
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(IPlayer*, CreatePlayer);
+	PUBLIC_FUNCTION(void*, GetTargetFieldPtr, const Type*, void*, const FieldInfo*&);
 }
 END_META;
 
@@ -142,6 +142,7 @@ namespace o2
 		mTime->Update(realdDt);
 		o2Debug.Update(dt);
 		mTaskManager->Update(dt);
+		mAssets->Update();
 		UpdateEventSystem();
 
 		mRender->Begin();
@@ -26,7 +26,10 @@ namespace o2
 	}
 
 	Asset::~Asset()
-	{}
+	{
+		if (mPreparedData)
+			delete mPreparedData;
+	}
 
 	const String& Asset::GetPath() const
 	{
@@ -166,6 +169,27 @@ namespace o2
 		data.SaveToFile(path);
 	}
 
+	void Asset::PrepareLoadData(const String& path)
+	{
+		mPreparedData = mnew DataDocument();
+		mPreparedData->LoadFromFile(path);
+	}
+
+	void Asset::CompleteLoadData(const String& path)
+	{
+		if (!mPreparedData)
+			return;
+
+		Deserialize(*mPreparedData);
+
+		delete mPreparedData;
+		mPreparedData = nullptr;
+	}
+
 }
 
 DECLARE_CLASS(o2::Asset);
+CLASS_SERIALIZATION_META(o2::Asset)
+{
+}
+END_META;
@@ -88,6 +88,8 @@ namespace o2
 
 		AssetInfo mInfo; // Asset info 
 
+		DataDocument* mPreparedData = nullptr; // Data parsed on worker thread in async loading, deserialized on main thread
+
 	private:
 		// Hidden default constructor
 		Asset();
@@ -120,6 +122,13 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		virtual void SaveData(const String& path) const;
 
+		// Prepares asset data in async loading. Called on worker thread, so it must not touch engine state, only
+		// read and decode data. By default parses data document
+		virtual void PrepareLoadData(const String& path);
+
+		// Completes async loading on main thread after PrepareLoadData. By default deserializes prepared data
+		virtual void CompleteLoadData(const String& path);
+
 		friend class AssetRef;
 		friend class Assets;
 		friend class AssetsBuilder;
@@ -166,6 +175,7 @@ CLASS_FIELDS_META(o2::Asset)
 	PUBLIC_FIELD(meta);
 	PUBLIC_FIELD(mMeta).DONT_DELETE_ATTRIBUTE().EDITOR_PROPERTY_ATTRIBUTE().EXPANDED_BY_DEFAULT_ATTRIBUTE().NO_HEADER_ATTRIBUTE();
 	PROTECTED_FIELD(mInfo);
+	PROTECTED_FIELD(mPreparedData).DEFAULT_VALUE(nullptr);
 }
 END_META;
 CLASS_METHODS_META(o2::Asset)
@@ -194,6 +204,8 @@ CLASS_METHODS_META(o2::Asset)
 	PROTECTED_FUNCTION(void, Load, const AssetInfo&);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
+	PROTECTED_FUNCTION(void, CompleteLoadData, const String&);
 }
 END_META;
 
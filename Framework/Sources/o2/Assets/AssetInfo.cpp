@@ -140,3 +140,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AssetInfo);
+CLASS_SERIALIZATION_META(o2::AssetInfo)
+{
+	SERIALIZABLE_FIELD(path);
+	SERIALIZABLE_FIELD(editTime);
+	SERIALIZABLE_FIELD_DEFAULT(meta, nullptr);
+	SERIALIZABLE_FIELD(children);
+}
+END_META;
@@ -232,3 +232,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AssetRef);
+CLASS_SERIALIZATION_META(o2::AssetRef)
+{
+}
+END_META;
@@ -102,6 +102,7 @@ namespace o2
 		// Updates specialized asset pointer
 		virtual void UpdateSpecAsset() {};
 
+		friend class AssetLoadHandle;
 		friend class Assets;
 	};
 
@@ -4,11 +4,16 @@
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/Types/BinaryAsset.h"
 #include "o2/Assets/Types/FolderAsset.h"
+#include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Texture.h"
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 
 namespace o2
 {
@@ -21,6 +26,8 @@ namespace o2
 
 		mAssetsBuilder = mnew AssetsBuilder();
 
+		mLoadingTimeHistogram.Resize(LoadingTimeHistogramSize, 0);
+
 		LoadAssetTypes();
 
 		if (::IsAssetsPrebuildEnabled())
@@ -31,6 +38,9 @@ namespace o2
 
 	Assets::~Assets()
 	{
+		CompleteAllAsyncLoadings();
+		UploadAsyncTextures();
+
 		delete mAssetsBuilder;
 	}
 
@@ -105,10 +115,17 @@ namespace o2
 			if (!assetInfo.IsValid())
 				return AssetRef();
 
+			if (mAsyncLoadings.ContainsKey(assetInfo.meta->ID()))
+				return GetAssetRef(assetInfo.meta->ID());
+
+			Timer timer;
+
 			auto type = assetInfo.meta->GetAssetType();
 			Asset* asset = (Asset*)type->CreateSample();
 			asset->Load(assetInfo);
 
+			RegisterLoadingTime(timer.GetTime());
+
 			cached = mnew AssetCache();
 			cached->asset = asset;
 			cached->referencesCount = 0;
@@ -123,6 +140,10 @@ namespace o2
 
 	AssetRef Assets::GetAssetRef(const UID& id)
 	{
+		std::shared_ptr<AsyncLoading> loading;
+		if (mAsyncLoadings.TryGetValue(id, loading))
+			CompleteAsyncLoading(loading, true);
+
 		auto cached = FindAssetCache(id);
 
 		if (!cached)
@@ -131,9 +152,13 @@ namespace o2
 			if (!assetInfo.IsValid())
 				return AssetRef();
 
+			Timer timer;
+
 			Asset* asset = (Asset*)assetInfo.meta->GetAssetType()->CreateSample();
 			asset->Load(id);
 
+			RegisterLoadingTime(timer.GetTime());
+
 			cached = mnew AssetCache();
 			cached->asset = asset;
 			cached->referencesCount = 0;
@@ -146,6 +171,135 @@ namespace o2
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
 
+	AssetLoadHandle Assets::LoadAsync(const UID& id)
+	{
+		std::shared_ptr<AsyncLoading> loading;
+		if (mAsyncLoadings.TryGetValue(id, loading))
+			return AssetLoadHandle(loading);
+
+		loading = std::make_shared<AsyncLoading>();
+		loading->id = id;
+
+		// Already cached asset is loaded immediately
+		if (auto cached = FindAssetCache(id))
+		{
+			loading->cache = cached;
+			loading->cache->referencesCount++;
+			loading->prepared = true;
+
+			return AssetLoadHandle(loading);
+		}
+
+		auto& assetInfo = GetAssetInfo(id);
+		if (!assetInfo.IsValid())
+		{
+			mLog->Error("Failed to load asset asynchronously by UID (" + (WString)id + "): asset isn't exist");
+			return AssetLoadHandle();
+		}
+
+		loading->asset = (Asset*)assetInfo.meta->GetAssetType()->CreateSample();
+		loading->asset->mInfo = assetInfo;
+
+		mAsyncLoadings.Add(id, loading);
+
+		// Job uses raw pointer: loading lives in mAsyncLoadings until completion, and completion
+		// waits for prepared flag under mutex, so loading is never destroyed on worker thread
+		AsyncLoading* loadingPtr = loading.get();
+		String builtPath = loading->asset->GetBuiltFullPath();
+
+		o2ThreadPool.Run([=]()
+		{
+			loadingPtr->asset->PrepareLoadData(builtPath);
+
+			std::unique_lock<std::mutex> lock(loadingPtr->mutex);
+			loadingPtr->prepared = true;
+			loadingPtr->preparedCV.notify_all();
+		});
+
+		return AssetLoadHandle(loading);
+	}
+
+	AssetLoadHandle Assets::LoadAsync(const String& path)
+	{
+		auto& assetInfo = GetAssetInfo(path);
+		if (!assetInfo.IsValid())
+		{
+			mLog->Error("Failed to load asset asynchronously by path (" + path + "): asset isn't exist");
+			return AssetLoadHandle();
+		}
+
+		return LoadAsync(assetInfo.meta->ID());
+	}
+
+	void Assets::Update()
+	{
+		mUpdateFrame++;
+
+		if (!mAsyncLoadings.IsEmpty())
+		{
+			UploadAsyncTextures();
+
+			auto loadings = mAsyncLoadings;
+			for (auto& kv : loadings)
+				CompleteAsyncLoading(kv.second, false);
+		}
+
+		CheckAssetsUnload();
+	}
+
+	const Vector<int>& Assets::GetLoadingTimeHistogram() const
+	{
+		return mLoadingTimeHistogram;
+	}
+
+	void Assets::ResetLoadingTimeHistogram()
+	{
+		for (auto& count : mLoadingTimeHistogram)
+			count = 0;
+	}
+
+	void Assets::SetCacheMemoryBudget(UInt64 bytes)
+	{
+		mCacheMemoryBudget = bytes;
+	}
+
+	UInt64 Assets::GetCacheMemoryBudget() const
+	{
+		return mCacheMemoryBudget;
+	}
+
+	const Assets::CacheStats& Assets::GetCacheStats() const
+	{
+		return mCacheStats;
+	}
+
+	void Assets::PrepareAsyncTexture(const String& fileName)
+	{
+		std::shared_ptr<AsyncTexture> texture;
+		std::unique_lock<std::mutex> entryLock;
+
+		{
+			std::unique_lock<std::mutex> lock(mAsyncTexturesMutex);
+			if (mAsyncTextures.TryGetValue(fileName, texture))
+			{
+				// Someone else decodes it, wait until it's done
+				lock.unlock();
+				std::unique_lock<std::mutex> waitLock(texture->mutex);
+				return;
+			}
+
+			texture = std::make_shared<AsyncTexture>();
+			entryLock = std::unique_lock<std::mutex>(texture->mutex);
+			mAsyncTextures.Add(fileName, texture);
+		}
+
+		Bitmap* bitmap = mnew Bitmap();
+		if (bitmap->Load(fileName, Bitmap::ImageType::Auto))
+			texture->bitmap = bitmap;
+		else
+			delete bitmap;
+	}
+
 	bool Assets::IsAssetExist(const String& path) const
 	{
 		return GetAssetInfo(path).meta->ID() != UID::empty;
@@ -339,6 +493,7 @@ namespace o2
 
 	void Assets::RebuildAssets(bool forcible /*= false*/)
 	{
+		CompleteAllAsyncLoadings();
 		ClearAssetsCache();
 
 		auto editorAssetsTree = mnew AssetsTree();
@@ -406,11 +561,18 @@ namespace o2
 	{
 		mAssetsTrees.Clear();
 
+		// Assets trees are loaded directly from files, they can be saved in json or binary format
+		DataDocument editorAssetsTreeData;
+		editorAssetsTreeData.LoadFromFile(::GetEditorBuiltAssetsTreePath());
+
 		auto editorAssetsTree = mnew AssetsTree();
-		editorAssetsTree->DeserializeFromString(o2FileSystem.ReadFile(::GetEditorBuiltAssetsTreePath()));
+		editorAssetsTree->Deserialize(editorAssetsTreeData);
+
+		DataDocument mainAssetsTreeData;
+		mainAssetsTreeData.LoadFromFile(::GetBuiltAssetsTreePath());
 
 		mMainAssetsTree = mnew AssetsTree();
-		mMainAssetsTree->DeserializeFromString(o2FileSystem.ReadFile(::GetBuiltAssetsTreePath()));
+		mMainAssetsTree->Deserialize(mainAssetsTreeData);
 
 		mAssetsTrees.Add(mMainAssetsTree);
 		mAssetsTrees.Add(editorAssetsTree);
@@ -443,33 +605,72 @@ namespace o2
 
 	void Assets::CheckAssetsUnload()
 	{
-		for (auto it = mCachedAssets.Begin(); it != mCachedAssets.End();)
+		mCacheStats.usedBytes = 0;
+		mCacheStats.cachedBytes = 0;
+		mCacheStats.cachedCount = 0;
+
+		Vector<AssetCache*> unreferencedCaches;
+		for (auto cache : mCachedAssets)
 		{
-			if ((*it)->referencesCount <= 0)
+			if (!cache->sizeKnown)
 			{
-				mCachedAssetsByPath.Remove((*it)->asset->GetPath());
-				mCachedAssetsByUID.Remove((*it)->asset->GetUID());
-
-				delete (*it)->asset;
-				delete* it;
+				String builtPath = cache->asset->GetBuiltFullPath();
+				cache->reloadable = o2FileSystem.IsFileExist(builtPath);
+				cache->size = cache->reloadable ? (UInt64)o2FileSystem.GetFileInfo(builtPath).size : 0;
+				cache->sizeKnown = true;
+			}
 
-				it = mCachedAssets.erase(it);
+			if (cache->referencesCount > 0 || !cache->reloadable)
+			{
+				cache->lastUsedFrame = mUpdateFrame;
+				mCacheStats.usedBytes += cache->size;
 			}
-			else ++it;
+			else
+			{
+				unreferencedCaches.Add(cache);
+				mCacheStats.cachedBytes += cache->size;
+				mCacheStats.cachedCount++;
+			}
+		}
+
+		if (mCacheStats.usedBytes + mCacheStats.cachedBytes <= mCacheMemoryBudget)
+			return;
+
+		unreferencedCaches.SortBy<UInt64>([](AssetCache* cache) { return cache->lastUsedFrame; });
+
+		for (auto cache : unreferencedCaches)
+		{
+			if (mCacheStats.usedBytes + mCacheStats.cachedBytes <= mCacheMemoryBudget)
+				break;
+
+			mCacheStats.cachedBytes -= cache->size;
+			mCacheStats.cachedCount--;
+			mCacheStats.evictedBytes += cache->size;
+			mCacheStats.evictedCount++;
+
+			mCachedAssetsByPath.Remove(cache->asset->GetPath());
+			mCachedAssetsByUID.Remove(cache->asset->GetUID());
+			mCachedAssets.Remove(cache);
+
+			delete cache;
 		}
 	}
 
 	Assets::AssetCache* Assets::FindAssetCache(const String& path)
 	{
 		Assets::AssetCache* res = nullptr;
-		mCachedAssetsByPath.TryGetValue(path, res);
+		if (mCachedAssetsByPath.TryGetValue(path, res))
+			res->lastUsedFrame = mUpdateFrame;
+
 		return res;
 	}
 
 	Assets::AssetCache* Assets::FindAssetCache(const UID& id)
 	{
 		Assets::AssetCache* res = nullptr;
-		mCachedAssetsByUID.TryGetValue(id, res);
+		if (mCachedAssetsByUID.TryGetValue(id, res))
+			res->lastUsedFrame = mUpdateFrame;
+
 		return res;
 	}
 
@@ -521,9 +722,173 @@ namespace o2
 		}
 	}
 
+	bool Assets::CompleteAsyncLoading(const std::shared_ptr<AsyncLoading>& loading, bool wait)
+	{
+		{
+			std::unique_lock<std::mutex> lock(loading->mutex);
+			if (!wait && !loading->prepared)
+				return false;
+
+			loading->preparedCV.wait(lock, [&]() { return (bool)loading->prepared; });
+		}
+
+		if (loading->cache)
+			return true;
+
+		mAsyncLoadings.Remove(loading->id);
+
+		// Texture could be decoded in this loading
+		UploadAsyncTextures();
+
+		Asset* asset = loading->asset;
+		loading->asset = nullptr;
+
+		asset->CompleteLoadData(asset->GetBuiltFullPath());
+
+		// Uploaded atlas page texture has no users yet, handle keeps it from unloading until image is used
+		if (auto image = dynamic_cast<ImageAsset*>(asset))
+			loading->texture = image->GetAtlasTextureRef();
+
+		loading->cache = mnew AssetCache();
+		loading->cache->asset = asset;
+		loading->cache->referencesCount = 1;
+
+		mCachedAssets.Add(loading->cache);
+		mCachedAssetsByPath[asset->GetPath()] = loading->cache;
+		mCachedAssetsByUID[asset->GetUID()] = loading->cache;
+
+		RegisterLoadingTime(loading->timer.GetTime());
+
+		AssetRef ref(asset, &loading->cache->referencesCount);
+		for (auto& callback : loading->callbacks)
+			callback(ref);
+
+		loading->callbacks.Clear();
+
+		return true;
+	}
+
+	void Assets::CompleteAllAsyncLoadings()
+	{
+		while (!mAsyncLoadings.IsEmpty())
+		{
+			auto loading = mAsyncLoadings.Begin()->second;
+			CompleteAsyncLoading(loading, true);
+		}
+	}
+
+	void Assets::UploadAsyncTextures()
+	{
+		std::unique_lock<std::mutex> lock(mAsyncTexturesMutex);
+
+		for (auto it = mAsyncTextures.Begin(); it != mAsyncTextures.End();)
+		{
+			const String& fileName = it->first;
+			auto& texture = it->second;
+
+			// Entry is decoding now
+			std::unique_lock<std::mutex> entryLock(texture->mutex, std::try_to_lock);
+			if (!entryLock.owns_lock())
+			{
+				++it;
+				continue;
+			}
+
+			auto fnd = o2Render.mTextures.FindOrDefault([&](Texture* tex) { return tex->GetFileName() == fileName; });
+
+			if (!texture->uploaded)
+			{
+				if (texture->bitmap && !fnd)
+					mnew Texture(fileName, texture->bitmap);
+
+				delete texture->bitmap;
+				texture->bitmap = nullptr;
+				texture->uploaded = true;
+
+				++it;
+			}
+			else if (!fnd)
+			{
+				// Texture was unloaded, it must be decoded again next time
+				entryLock.unlock();
+				it = mAsyncTextures.erase(it);
+			}
+			else ++it;
+		}
+	}
+
+	void Assets::RegisterLoadingTime(float seconds)
+	{
+		float milliseconds = seconds*1000.0f;
+
+		int bucket = 0;
+		float bucketBound = 1.0f;
+		while (bucket < LoadingTimeHistogramSize - 1 && milliseconds >= bucketBound)
+		{
+			bucket++;
+			bucketBound *= 2.0f;
+		}
+
+		mLoadingTimeHistogram[bucket]++;
+	}
+
 	Assets::AssetCache::~AssetCache()
 	{
 		delete asset;
 	}
 
+	Assets::AsyncLoading::~AsyncLoading()
+	{
+		if (cache)
+			cache->referencesCount--;
+
+		if (asset)
+			delete asset;
+	}
+
+	AssetLoadHandle::AssetLoadHandle()
+	{}
+
+	AssetLoadHandle::AssetLoadHandle(const std::shared_ptr<Assets::AsyncLoading>& loading):
+		mLoading(loading)
+	{}
+
+	bool AssetLoadHandle::IsValid() const
+	{
+		return mLoading != nullptr;
+	}
+
+	bool AssetLoadHandle::IsLoaded() const
+	{
+		return mLoading && mLoading->cache;
+	}
+
+	AssetRef AssetLoadHandle::GetAssetRef() const
+	{
+		if (!IsLoaded())
+			return AssetRef();
+
+		return AssetRef(mLoading->cache->asset, &mLoading->cache->referencesCount);
+	}
+
+	AssetRef AssetLoadHandle::Wait()
+	{
+		if (!mLoading)
+			return AssetRef();
+
+		o2Assets.CompleteAsyncLoading(mLoading, true);
+		return GetAssetRef();
+	}
+
+	void AssetLoadHandle::Then(const Function<void(const AssetRef&)>& callback)
+	{
+		if (!mLoading)
+			return;
+
+		if (IsLoaded())
+			callback(GetAssetRef());
+		else
+			mLoading->callbacks.Add(callback);
+	}
+
 }
@@ -4,18 +4,26 @@
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Assets/AssetRef.h"
 #include "o2/Assets/AssetsTree.h"
+#include "o2/Render/TextureRef.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/System/Time/Timer.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 // Assets system access macros
 #define  o2Assets o2::Assets::Instance()
 
 namespace o2
 {
+	class AssetLoadHandle;
 	class AssetsBuilder;
+	class Bitmap;
 	class LogStream;
 
 	// ----------------
@@ -27,6 +35,21 @@ namespace o2
 		PROPERTIES(Assets);
 		GETTER(String, assetsPath, GetAssetsPath); // Assets path getter
 
+	public:
+		static constexpr int LoadingTimeHistogramSize = 12; // Count of loading time histogram buckets
+
+		// -----------------------
+		// Assets cache statistics
+		// -----------------------
+		struct CacheStats
+		{
+			UInt64 usedBytes = 0;    // Memory of referenced assets
+			UInt64 cachedBytes = 0;  // Memory of unreferenced assets kept in cache
+			int    cachedCount = 0;  // Count of unreferenced assets kept in cache
+			UInt64 evictedBytes = 0; // Summary memory of evicted assets
+			int    evictedCount = 0; // Count of evicted assets
+		};
+
 	public:
 		Function<void(const Vector<UID>&)> onAssetsRebuilt; // Assets rebuilding event
 
@@ -70,6 +93,37 @@ namespace o2
 		// Returns asset reference by id
 		AssetRef GetAssetRef(const UID& id);
 
+		// Starts asynchronous asset loading by id. File reading and decoding are processed on worker threads,
+		// loading is completed on main thread in Update(). Concurrent requests for same asset share one loading
+		AssetLoadHandle LoadAsync(const UID& id);
+
+		// Starts asynchronous asset loading by path
+		AssetLoadHandle LoadAsync(const String& path);
+
+		// Completes prepared asynchronous loadings, uploads decoded textures. Called on main thread every frame
+		void Update();
+
+		// Returns assets loading times histogram. Bucket i counts loadings faster than 2^i milliseconds,
+		// last bucket counts all slower loadings
+		const Vector<int>& GetLoadingTimeHistogram() const;
+
+		// Resets loading times histogram
+		void ResetLoadingTimeHistogram();
+
+		// Sets assets cache memory budget in bytes. Unreferenced assets stay in cache while cache fits budget,
+		// least recently used of them are unloaded first. Asset size is estimated by its built data size
+		void SetCacheMemoryBudget(UInt64 bytes);
+
+		// Returns assets cache memory budget in bytes
+		UInt64 GetCacheMemoryBudget() const;
+
+		// Returns assets cache statistics
+		const CacheStats& GetCacheStats() const;
+
+		// Decodes texture file for asynchronous loading. Called on worker thread. Each file is decoded once,
+		// texture is created on main thread in Update()
+		void PrepareAsyncTexture(const String& fileName);
+
 		// Creates asset type _asset_type
 		template<typename _asset_type, typename ... _args>
 		AssetRef CreateAsset(_args ... args);
@@ -137,9 +191,46 @@ namespace o2
 			Asset* asset;
 			int    referencesCount;
 
+			UInt64 size = 0;           // Estimated asset memory size in bytes
+			bool   sizeKnown = false;  // Is size calculated
+			bool   reloadable = false; // Is asset has built data and can be loaded again after unloading
+			UInt64 lastUsedFrame = 0;  // Index of last update when asset was referenced or requested
+
 			~AssetCache();
 		};
 
+		// ---------------------------------------------------------------------------------------
+		// Asynchronous asset loading. Shared between handles and worker job, keeps reference to
+		// cached asset after completion
+		// ---------------------------------------------------------------------------------------
+		struct AsyncLoading
+		{
+			UID         id;                // Loading asset id
+			Asset*      asset = nullptr;   // Loading asset, owned by loading until completion
+			AssetCache* cache = nullptr;   // Asset cache, valid when loading is completed
+			Timer       timer;             // Loading timer, started at request
+			TextureRef  texture;           // Texture uploaded for asset, kept loaded while loading handle is alive
+
+			std::atomic<bool>       prepared { false }; // Is data prepared on worker thread
+			std::mutex              mutex;              // Prepared condition mutex
+			std::condition_variable preparedCV;         // Notified when data prepared
+
+			Vector<Function<void(const AssetRef&)>> callbacks; // Called on main thread when loading completes
+
+			// Destructor, releases asset cache reference
+			~AsyncLoading();
+		};
+
+		// -----------------------------------------------------------------------------
+		// Texture decoded on worker thread. Entry mutex is locked while file is decoding
+		// -----------------------------------------------------------------------------
+		struct AsyncTexture
+		{
+			std::mutex mutex;              // Decoding mutex
+			Bitmap*    bitmap = nullptr;   // Decoded bitmap, null when decoding failed or texture is uploaded
+			bool       uploaded = false;   // Is texture created on main thread
+		};
+
 	protected:
 		AssetsTree*         mMainAssetsTree; // Main assets tree
 		Vector<AssetsTree*> mAssetsTrees;    // Assets trees
@@ -153,6 +244,17 @@ namespace o2
 		Map<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
 		Map<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
 
+		Map<UID, std::shared_ptr<AsyncLoading>> mAsyncLoadings; // Not completed asynchronous loadings by asset id
+
+		Map<String, std::shared_ptr<AsyncTexture>> mAsyncTextures;      // Decoded and uploaded textures by file name
+		std::mutex                                 mAsyncTexturesMutex; // Async textures map mutex
+
+		Vector<int> mLoadingTimeHistogram; // Loading times histogram, see GetLoadingTimeHistogram()
+
+		UInt64     mCacheMemoryBudget = 64*1024*1024; // Assets cache memory budget in bytes
+		CacheStats mCacheStats;                       // Assets cache statistics
+		UInt64     mUpdateFrame = 0;                  // Index of update, used as LRU time
+
 	protected:
 		// Loads asset infos
 		void LoadAssetsTree();
@@ -160,7 +262,7 @@ namespace o2
 		// Initializes types extensions dictionary
 		void LoadAssetTypes();
 
-		// Checks assets with zero references and removes them
+		// Updates cache statistics and unloads least recently used assets with zero references when cache exceeds budget
 		void CheckAssetsUnload();
 
 		// Returns asset cache by path
@@ -178,6 +280,18 @@ namespace o2
 		// Removes asset from cache by UID and path
 		void RemoveAssetCache(Asset* asset);
 
+		// Waits data preparing if wait is true and completes loading on main thread. Returns false when data isn't prepared yet
+		bool CompleteAsyncLoading(const std::shared_ptr<AsyncLoading>& loading, bool wait);
+
+		// Waits and completes all asynchronous loadings
+		void CompleteAllAsyncLoadings();
+
+		// Creates textures for decoded bitmaps, forgets uploaded textures that were unloaded
+		void UploadAsyncTextures();
+
+		// Adds loading time into histogram
+		void RegisterLoadingTime(float seconds);
+
 		// Removes asset by info
 		bool RemoveAsset(const AssetInfo& info, bool rebuildAssets = true);
 
@@ -191,10 +305,46 @@ namespace o2
 		bool RenameAsset(const AssetInfo& info, const String& newName, bool rebuildAssets = true);
 
 		friend class Asset;
+		friend class AssetLoadHandle;
 		friend class AssetRef;
 		friend class FolderAsset;
 	};
 
+	// -------------------------------------------------------------------------------------------
+	// Asynchronous asset loading handle. Returned by Assets::LoadAsync, asset becomes available
+	// when loading is completed on main thread. Handle keeps loaded asset in cache while it's alive
+	// -------------------------------------------------------------------------------------------
+	class AssetLoadHandle
+	{
+	public:
+		// Default constructor, invalid handle
+		AssetLoadHandle();
+
+		// Returns true when handle refers to loading
+		bool IsValid() const;
+
+		// Returns true when asset is loaded
+		bool IsLoaded() const;
+
+		// Returns loaded asset reference, or empty reference when asset isn't loaded yet
+		AssetRef GetAssetRef() const;
+
+		// Waits data preparing and completes loading immediately. Must be called on main thread
+		AssetRef Wait();
+
+		// Calls callback on main thread when asset is loaded, or immediately when it's already loaded
+		void Then(const Function<void(const AssetRef&)>& callback);
+
+	protected:
+		std::shared_ptr<Assets::AsyncLoading> mLoading; // Shared loading
+
+	protected:
+		// Constructor from loading
+		AssetLoadHandle(const std::shared_ptr<Assets::AsyncLoading>& loading);
+
+		friend class Assets;
+	};
+
 	template<typename _asset_type, typename ... _args>
 	AssetRef Assets::CreateAsset(_args ... args)
 	{
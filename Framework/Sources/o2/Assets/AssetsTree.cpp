@@ -211,3 +211,10 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AssetsTree);
+CLASS_SERIALIZATION_META(o2::AssetsTree)
+{
+	SERIALIZABLE_FIELD(assetsPath);
+	SERIALIZABLE_FIELD(builtAssetsPath);
+	SERIALIZABLE_FIELD(rootAssets);
+}
+END_META;
@@ -7,14 +7,18 @@
 #include "o2/Assets/Builder/AtlasAssetConverter.h"
 #include "o2/Assets/Builder/FolderAssetConverter.h"
 #include "o2/Assets/Builder/ImageAssetConverter.h"
+#include "o2/EngineSettings.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 
 namespace o2
 {
-	AssetsBuilder::AssetsBuilder()
+	AssetsBuilder::AssetsBuilder():
+		mBinaryDataFormat(IsReleaseBuild()), mBuildDatabaseChanged(false), mBuiltTreeChanged(false)
 	{
 		mLog = mnew LogStream("Assets builder");
 		o2Debug.GetLog()->BindStream(mLog);
@@ -43,6 +47,8 @@ namespace o2
 
 		if (forcible)
 			RemoveBuiltAssets();
+		else
+			LoadBuildDatabase();
 
 		CheckBasicAtlas();
 
@@ -61,15 +67,22 @@ namespace o2
 		ProcessRemovedAssets();
 		ProcessNewAssets();
 		ProcessModifiedAssets();
+		RunConvertJobs();
 		ConvertersPostProcess();
 
-		if (!mModifiedAssets.IsEmpty())
+		if (!mModifiedAssets.IsEmpty() || mBuiltTreeChanged)
 		{
 			mBuiltAssetsTree->assetsPath = mSourceAssetsPath;
 			mBuiltAssetsTree->builtAssetsPath = mBuiltAssetsPath;
-			o2FileSystem.WriteFile(mBuiltAssetsTreePath, mBuiltAssetsTree->SerializeToString());
+
+			DataDocument builtAssetsTreeData;
+			mBuiltAssetsTree->Serialize(builtAssetsTreeData);
+			builtAssetsTreeData.SaveToFile(mBuiltAssetsTreePath, GetBuiltDataFormat());
 		}
 
+		SaveBuildDatabase();
+		PrintBuildReport();
+
 		mLog->Out("Completed for " + (String)timer.GetDeltaTime() + " seconds");
 
 		return mModifiedAssets;
@@ -85,6 +98,64 @@ namespace o2
 		return mBuiltAssetsPath;
 	}
 
+	void AssetsBuilder::SetBinaryDataFormat(bool enabled)
+	{
+		mBinaryDataFormat = enabled;
+	}
+
+	bool AssetsBuilder::IsBinaryDataFormat() const
+	{
+		return mBinaryDataFormat;
+	}
+
+	DataDocument::Format AssetsBuilder::GetBuiltDataFormat() const
+	{
+		return mBinaryDataFormat ? DataDocument::Format::Binary : DataDocument::Format::JSON;
+	}
+
+	bool AssetsBuilder::ConvertDataFile(const String& sourcePath, const String& destPath, DataDocument::Format format)
+	{
+		DataDocument data;
+		if (!data.LoadFromFile(sourcePath))
+			return false;
+
+		return data.SaveToFile(destPath, format);
+	}
+
+	UInt64 AssetsBuilder::GetDataHash(const void* data, UInt size)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		const unsigned char* bytes = (const unsigned char*)data;
+		for (UInt i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	UInt64 AssetsBuilder::GetFileHash(const String& path)
+	{
+		InFile file(path);
+		if (!file.IsOpened())
+			return 0;
+
+		UInt size = file.GetDataSize();
+		char* data = mnew char[size + 1];
+		file.ReadData(data, size);
+
+		UInt64 hash = GetDataHash(data, size);
+		delete[] data;
+
+		return hash;
+	}
+
+	UInt64 AssetsBuilder::HashCombine(UInt64 hash, UInt64 value)
+	{
+		return hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+	}
+
 	void AssetsBuilder::InitializeConverters()
 	{
 		auto converterTypes = TypeOf(IAssetConverter).GetDerivedTypes();
@@ -192,6 +263,8 @@ namespace o2
 				GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
 				mModifiedAssets.Add(builtAssetInfo->meta->ID());
+				mBuildDatabase.Remove(builtAssetInfo->meta->ID());
+				mBuildDatabaseChanged = true;
 
 				mLog->OutStr("Removed asset: " + builtAssetInfo->path);
 
@@ -229,12 +302,13 @@ namespace o2
 				{
 					auto builtAssetInfo = fnd->second;
 
+					bool changed = IsAssetChanged(*sourceAssetInfo, *builtAssetInfo);
+
 					if (sourceAssetInfo->path == builtAssetInfo->path)
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (changed)
 						{
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							ConvertAsset(*sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -244,11 +318,16 @@ namespace o2
 
 							mLog->Out("Modified asset: " + sourceAssetInfo->path);
 						}
+						else if (sourceAssetInfo->editTime != builtAssetInfo->editTime)
+						{
+							// Touched, but content is same: only remember new edit time
+							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							mBuiltTreeChanged = true;
+						}
 					}
 					else
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (changed)
 						{
 							GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
@@ -262,7 +341,7 @@ namespace o2
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							ConvertAsset(*sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 							mBuiltAssetsTree->AddAsset(builtAssetInfo);
@@ -314,7 +393,7 @@ namespace o2
 				if (!isNew)
 					continue;
 
-				GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				ConvertAsset(*sourceAssetInfo);
 
 				mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -330,12 +409,144 @@ namespace o2
 		}
 	}
 
+	void AssetsBuilder::ConvertAsset(const AssetInfo& sourceAssetInfo)
+	{
+		IAssetConverter* converter = GetAssetConverter(sourceAssetInfo.meta->GetAssetType());
+
+		// Folders are converted immediately, files converting jobs are launched after all folders are created
+		if (sourceAssetInfo.meta->GetAssetType() == &TypeOf(FolderAsset))
+		{
+			converter->ConvertAsset(sourceAssetInfo);
+
+			AssetBuildRecord record;
+			record.id = sourceAssetInfo.meta->ID();
+			record.converterVersion = converter->GetVersion();
+			mBuildDatabase.Set(record.id, record);
+			mBuildDatabaseChanged = true;
+
+			return;
+		}
+
+		ConvertJob job;
+		job.converter = converter;
+		job.assetInfo = &sourceAssetInfo;
+		mConvertJobs.Add(job);
+	}
+
+	void AssetsBuilder::RunConvertJobs()
+	{
+		o2ThreadPool.ParallelFor(mConvertJobs.Count(), [&](int idx)
+		{
+			ConvertJob& job = mConvertJobs[idx];
+
+			Timer timer;
+			job.hash = GetFileHash(mSourceAssetsPath + job.assetInfo->path);
+			job.converter->ConvertAsset(*job.assetInfo);
+			job.time = timer.GetDeltaTime();
+		});
+
+		for (auto& job : mConvertJobs)
+		{
+			AssetBuildRecord record;
+			record.id = job.assetInfo->meta->ID();
+			record.hash = job.hash;
+			record.converterVersion = job.converter->GetVersion();
+			mBuildDatabase.Set(record.id, record);
+
+			ConverterReport& report = mConvertersReport[job.converter->GetType().GetName()];
+			report.convertedCount++;
+			report.convertingTime += job.time;
+		}
+
+		if (!mConvertJobs.IsEmpty())
+			mBuildDatabaseChanged = true;
+
+		mConvertJobs.Clear();
+	}
+
 	void AssetsBuilder::ConvertersPostProcess()
 	{
+		Timer timer;
 		for (auto it = mAssetConverters.Begin(); it != mAssetConverters.End(); ++it)
+		{
+			timer.Reset();
 			mModifiedAssets.Add(it->second->AssetsPostProcess());
+			mConvertersReport[it->second->GetType().GetName()].postProcessTime += timer.GetDeltaTime();
+		}
 
+		timer.Reset();
 		mModifiedAssets.Add(mStdAssetConverter.AssetsPostProcess());
+		mConvertersReport[mStdAssetConverter.GetType().GetName()].postProcessTime += timer.GetDeltaTime();
+	}
+
+	bool AssetsBuilder::IsAssetChanged(const AssetInfo& sourceAssetInfo, const AssetInfo& builtAssetInfo)
+	{
+		if (!sourceAssetInfo.meta->IsEqual(builtAssetInfo.meta))
+			return true;
+
+		AssetBuildRecord record;
+		bool hasRecord = mBuildDatabase.TryGetValue(sourceAssetInfo.meta->ID(), record);
+
+		IAssetConverter* converter = GetAssetConverter(sourceAssetInfo.meta->GetAssetType());
+		if (hasRecord && record.converterVersion != converter->GetVersion())
+			return true;
+
+		if (sourceAssetInfo.editTime == builtAssetInfo.editTime)
+			return false;
+
+		// Edit time changed, compare content with last build
+		if (!hasRecord)
+			return true;
+
+		if (sourceAssetInfo.meta->GetAssetType() == &TypeOf(FolderAsset))
+			return false;
+
+		return GetFileHash(mSourceAssetsPath + sourceAssetInfo.path) != record.hash;
+	}
+
+	String AssetsBuilder::GetBuildDatabasePath() const
+	{
+		return o2FileSystem.GetFileNameWithoutExtension(mBuiltAssetsTreePath) + ".build";
+	}
+
+	void AssetsBuilder::LoadBuildDatabase()
+	{
+		DataDocument data;
+		if (!data.LoadFromFile(GetBuildDatabasePath()))
+			return;
+
+		Vector<AssetBuildRecord> records;
+		records = data;
+
+		for (auto& record : records)
+			mBuildDatabase.Add(record.id, record);
+	}
+
+	void AssetsBuilder::SaveBuildDatabase()
+	{
+		if (!mBuildDatabaseChanged)
+			return;
+
+		Vector<AssetBuildRecord> records;
+		for (auto& kv : mBuildDatabase)
+			records.Add(kv.second);
+
+		DataDocument data;
+		data = records;
+		data.SaveToFile(GetBuildDatabasePath(), GetBuiltDataFormat());
+	}
+
+	void AssetsBuilder::PrintBuildReport()
+	{
+		for (auto& kv : mConvertersReport)
+		{
+			if (kv.second.convertedCount == 0 && kv.second.postProcessTime < 0.001f)
+				continue;
+
+			mLog->Out(kv.first + ": converted " + (String)kv.second.convertedCount + " assets for " +
+					  (String)kv.second.convertingTime + " seconds, post process " + (String)kv.second.postProcessTime +
+					  " seconds");
+		}
 	}
 
 	void AssetsBuilder::GenerateMeta(const Type& assetType, const String& metaFullPath)
@@ -363,6 +574,11 @@ namespace o2
 	void AssetsBuilder::Reset()
 	{
 		mModifiedAssets.Clear();
+		mConvertJobs.Clear();
+		mConvertersReport.Clear();
+		mBuildDatabase.Clear();
+		mBuildDatabaseChanged = false;
+		mBuiltTreeChanged = false;
 		mSourceAssetsTree.Clear();
 		mBuiltAssetsTree->Clear();
 
@@ -371,4 +587,18 @@ namespace o2
 
 		mStdAssetConverter.Reset();
 	}
+
+	bool AssetsBuilder::AssetBuildRecord::operator==(const AssetBuildRecord& other) const
+	{
+		return id == other.id && hash == other.hash && converterVersion == other.converterVersion;
+	}
+}
+
+DECLARE_CLASS(o2::AssetsBuilder::AssetBuildRecord);
+CLASS_SERIALIZATION_META(o2::AssetsBuilder::AssetBuildRecord)
+{
+	SERIALIZABLE_FIELD(id);
+	SERIALIZABLE_FIELD_DEFAULT(hash, 0);
+	SERIALIZABLE_FIELD_DEFAULT(converterVersion, 0);
 }
+END_META;
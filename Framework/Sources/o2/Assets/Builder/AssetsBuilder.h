@@ -33,6 +33,67 @@ namespace o2
 		// Returns built assets path in building
 		const String& GetBuiltAssetsPath() const;
 
+		// Sets converting built data assets and assets tree into binary format
+		void SetBinaryDataFormat(bool enabled);
+
+		// Returns is built data assets and assets tree converting into binary format
+		bool IsBinaryDataFormat() const;
+
+		// Returns format of built data files
+		DataDocument::Format GetBuiltDataFormat() const;
+
+		// Converts data file between json and binary formats. Source format is detected automatically
+		static bool ConvertDataFile(const String& sourcePath, const String& destPath, DataDocument::Format format);
+
+		// Returns FNV-1a hash of data
+		static UInt64 GetDataHash(const void* data, UInt size);
+
+		// Returns hash of file content, 0 when file can't be opened
+		static UInt64 GetFileHash(const String& path);
+
+		// Combines hash with value
+		static UInt64 HashCombine(UInt64 hash, UInt64 value);
+
+	public:
+		// -------------------------------------------------------------------------------------
+		// Build database record. Keeps source content hash and converter version of last build,
+		// touched but unchanged assets are not converted again
+		// -------------------------------------------------------------------------------------
+		struct AssetBuildRecord: public ISerializable
+		{
+			UID    id;                   // Asset id @SERIALIZABLE
+			UInt64 hash = 0;             // Source asset content hash @SERIALIZABLE
+			int    converterVersion = 0; // Version of converter that built asset @SERIALIZABLE
+
+		public:
+			// Check equal operator
+			bool operator==(const AssetBuildRecord& other) const;
+
+			SERIALIZABLE(AssetBuildRecord);
+		};
+
+	protected:
+		// --------------------------------------------------------------
+		// Asset converting job. Jobs are independent and run in parallel
+		// --------------------------------------------------------------
+		struct ConvertJob
+		{
+			IAssetConverter* converter = nullptr; // Asset converter
+			const AssetInfo* assetInfo = nullptr; // Source asset info
+			UInt64           hash = 0;            // Source asset content hash, calculated in job
+			float            time = 0.0f;         // Converting duration in seconds
+		};
+
+		// ------------------------------------
+		// Converter time statistics for report
+		// ------------------------------------
+		struct ConverterReport
+		{
+			int   convertedCount = 0;     // Count of converted assets
+			float convertingTime = 0.0f;  // Summary converting time of all jobs, in seconds
+			float postProcessTime = 0.0f; // Post process time, in seconds
+		};
+
 	protected:
 		LogStream* mLog; // Asset builder log stream
 
@@ -45,6 +106,15 @@ namespace o2
 
 		Vector<UID> mModifiedAssets; // Modified assets infos
 
+		bool mBinaryDataFormat; // Built data assets and assets tree are saved in binary format when true
+
+		Map<UID, AssetBuildRecord> mBuildDatabase;        // Build records by asset id. Stored near built assets tree
+		bool                       mBuildDatabaseChanged; // Is build database changed and needs to be saved
+		bool                       mBuiltTreeChanged;     // Is built tree changed without modified assets, when only edit times are updated
+
+		Vector<ConvertJob>           mConvertJobs;      // Delayed converting jobs of files
+		Map<String, ConverterReport> mConvertersReport; // Converters time statistics by converter type name
+
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
 
@@ -67,8 +137,30 @@ namespace o2
 		// Searches new assets
 		void ProcessNewAssets();
 
+		// Converts folder immediately or delays file converting into jobs
+		void ConvertAsset(const AssetInfo& sourceAssetInfo);
+
+		// Runs delayed converting jobs in parallel and updates build database
+		void RunConvertJobs();
+
 		// Launches converters post process
 		void ConvertersPostProcess();
+
+		// Returns true when source asset differs from built: by meta, converter version or content.
+		// Edit time change with same content hash is not a change
+		bool IsAssetChanged(const AssetInfo& sourceAssetInfo, const AssetInfo& builtAssetInfo);
+
+		// Returns build database file path, near built assets tree
+		String GetBuildDatabasePath() const;
+
+		// Loads build database
+		void LoadBuildDatabase();
+
+		// Saves build database if changed
+		void SaveBuildDatabase();
+
+		// Prints converters time statistics
+		void PrintBuildReport();
 		
 		// Processes folder for missing metas
 		void ProcessMissingMetasCreation(FolderInfo& folder);
@@ -85,3 +177,20 @@ namespace o2
 		friend class AtlasAssetConverter;
 	};
 }
+
+CLASS_BASES_META(o2::AssetsBuilder::AssetBuildRecord)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::AssetsBuilder::AssetBuildRecord)
+{
+	PUBLIC_FIELD(id).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(hash).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(converterVersion).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::AssetsBuilder::AssetBuildRecord)
+{
+}
+END_META;
@@ -7,6 +7,7 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 
 namespace o2
 {
@@ -186,38 +187,58 @@ namespace o2
 		RectsPacker packer(meta->windows.maxSize);
 		float imagesBorder = (float)meta->border;
 
-		// Initialize pack images
-		Vector<ImagePackDef> packImages;
-		for (auto img : images)
+		// Find images infos
+		Vector<AssetInfo*> imagesInfos;
+		for (auto& img : images)
 		{
-			// Find image info
 			AssetInfo* imgInfo = nullptr;
 			mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(img.id, imgInfo);
 			if (!imgInfo)
-			{
 				mAssetsBuilder->mLog->Error("Can't find asset info by id: " + (String)img.id);
-				continue;
-			}
 
-			String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path;
+			imagesInfos.Add(imgInfo);
+		}
+
+		// Load bitmaps in parallel, each job writes only its own slot
+		Vector<Bitmap*> bitmaps;
+		bitmaps.Resize(images.Count(), nullptr);
+
+		o2ThreadPool.ParallelFor(images.Count(), [&](int idx)
+		{
+			if (!imagesInfos[idx])
+				return;
 
-			// Load bitmap
 			Bitmap* bitmap = mnew Bitmap();
-			if (!bitmap->Load(assetFullPath))
+			if (bitmap->Load(mAssetsBuilder->GetSourceAssetsPath() + imagesInfos[idx]->path))
 			{
-				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgInfo->path);
-				delete bitmap;
+				images[idx].hash = GetBitmapHash(bitmap);
+				bitmaps[idx] = bitmap;
+			}
+			else delete bitmap;
+		});
+
+		// Initialize pack images in images order, so packing result doesn't depend on loading order
+		Vector<ImagePackDef> packImages;
+		for (int i = 0; i < images.Count(); i++)
+		{
+			if (!imagesInfos[i])
+				continue;
+
+			if (!bitmaps[i])
+			{
+				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imagesInfos[i]->path);
 				continue;
 			}
 
 			// Create packing rect
-			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize() +
+			RectsPacker::Rect* packRect = packer.AddRect(bitmaps[i]->GetSize() +
 														 Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
 
 			ImagePackDef imagePackDef;
-			imagePackDef.assetInfo = imgInfo;
-			imagePackDef.bitmap = bitmap;
+			imagePackDef.assetInfo = imagesInfos[i];
+			imagePackDef.bitmap = bitmaps[i];
 			imagePackDef.packRect = packRect;
+			imagePackDef.hash = images[i].hash;
 
 			packImages.Add(imagePackDef);
 		}
@@ -226,14 +247,33 @@ namespace o2
 		if (!packer.Pack())
 		{
 			mAssetsBuilder->mLog->Error("Atlas " + atlasInfo->path + " packing failed");
+
+			for (auto bitmap : bitmaps)
+				delete bitmap;
+
 			return;
 		}
 		else mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed");
 
-		// Initialize bitmaps and pages
+		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
+		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
+
+		// Get previous pages hashes for skipping unchanged pages encoding
+		Vector<UInt64> lastPagesHashes;
+		{
+			DataDocument lastAtlasData;
+			if (lastAtlasData.LoadFromFile(atlasFullBuiltPath))
+			{
+				if (auto hashesData = lastAtlasData.FindMember("mPagesHashes"))
+					lastPagesHashes = *hashesData;
+			}
+		}
+
+		// Initialize pages, group images by pages and calculate pages hashes
 		int pagesCount = packer.GetPagesCount();
-		Vector<Bitmap*> resAtlasBitmaps;
 		Vector<AtlasAsset::Page> resAtlasPages;
+		Vector<Vector<ImagePackDef*>> pagesImages;
+		Vector<UInt64> pagesHashes;
 		for (int i = 0; i < pagesCount; i++)
 		{
 			AtlasAsset::Page atlasPage;
@@ -241,49 +281,70 @@ namespace o2
 			atlasPage.mSize = packer.GetMaxSize();
 			resAtlasPages.Add(atlasPage);
 
-			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, packer.GetMaxSize());
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-
-			resAtlasBitmaps.Add(newBitmap);
+			pagesImages.Add(Vector<ImagePackDef*>());
+			pagesHashes.Add(AssetsBuilder::GetDataHash(&atlasPage.mSize, sizeof(atlasPage.mSize)));
 		}
 
-		// Save image assets data and fill pages
-		for (auto imgDef : packImages)
+		for (auto& imgDef : packImages)
 		{
 			imgDef.packRect->rect.left += imagesBorder;
 			imgDef.packRect->rect.right -= imagesBorder;
 			imgDef.packRect->rect.top -= imagesBorder;
 			imgDef.packRect->rect.bottom += imagesBorder;
 
-			resAtlasBitmaps[imgDef.packRect->page]->CopyImage(imgDef.bitmap,
-															  imgDef.packRect->rect.LeftBottom());
+			int page = imgDef.packRect->page;
+			RectI rect = (RectI)(imgDef.packRect->rect);
+			UID id = imgDef.assetInfo->meta->ID();
 
-			resAtlasPages[imgDef.packRect->page].mImagesRects.Add(imgDef.assetInfo->meta->ID(),
-																  imgDef.packRect->rect);
+			resAtlasPages[page].mImagesRects.Add(id, imgDef.packRect->rect);
+			pagesImages[page].Add(&imgDef);
 
-			SaveImageAsset(imgDef);
+			UInt64& pageHash = pagesHashes[page];
+			pageHash = AssetsBuilder::HashCombine(pageHash, AssetsBuilder::GetDataHash(id.data, sizeof(id.data)));
+			pageHash = AssetsBuilder::HashCombine(pageHash, AssetsBuilder::GetDataHash(&rect, sizeof(rect)));
+			pageHash = AssetsBuilder::HashCombine(pageHash, imgDef.hash);
 		}
 
-		// Save pages bitmaps
-		for (int i = 0; i < pagesCount; i++)
+		// Blit and encode changed pages in parallel, each job owns its page bitmap
+		o2ThreadPool.ParallelFor(pagesCount, [&](int page)
 		{
-			resAtlasBitmaps[i]->Save(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)i + ".png",
-									 Bitmap::ImageType::Png);
+			String pagePath = atlasFullBuiltPath + (String)page + ".png";
 
-			delete resAtlasBitmaps[i];
-		}
+			if (page < lastPagesHashes.Count() && lastPagesHashes[page] == pagesHashes[page] &&
+				o2FileSystem.IsFileExist(pagePath))
+			{
+				return;
+			}
 
-		// Save atlas data
-		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
-		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
+			Bitmap pageBitmap(PixelFormat::R8G8B8A8, packer.GetMaxSize());
+			pageBitmap.Fill(Color4(255, 255, 255, 0));
+
+			for (auto imgDef : pagesImages[page])
+				pageBitmap.CopyImage(imgDef->bitmap, imgDef->packRect->rect.LeftBottom());
 
+			pageBitmap.Save(pagePath, Bitmap::ImageType::Png);
+		});
+
+		// Save image assets data
+		for (auto& imgDef : packImages)
+			SaveImageAsset(imgDef);
+
+		for (auto bitmap : bitmaps)
+			delete bitmap;
+
+		// Remove pages left from previous packing
+		for (int i = pagesCount; i < lastPagesHashes.Count(); i++)
+			o2FileSystem.FileDelete(atlasFullBuiltPath + (String)i + ".png");
+
+		// Save atlas data
 		DataDocument atlasData;
 		atlasData.LoadFromFile(atlasFullPath);
 		atlasData["mPages"] = resAtlasPages;
 		atlasData["mImages"] = images;
+		atlasData["mPagesHashes"] = pagesHashes;
 
 		atlasData.SaveToFile(atlasFullPath);
-		atlasData.SaveToFile(atlasFullBuiltPath);
+		atlasData.SaveToFile(atlasFullBuiltPath, mAssetsBuilder->GetBuiltDataFormat());
 
 		o2FileSystem.SetFileEditDate(atlasFullPath, atlasInfo->editTime);
 		o2FileSystem.SetFileEditDate(atlasFullBuiltPath, atlasInfo->editTime);
@@ -295,7 +356,7 @@ namespace o2
 		imgData["mAtlasPage"] = imgDef.packRect->page;
 		imgData["mAtlasRect"] = (RectI)(imgDef.packRect->rect);
 		String imageFullPath = mAssetsBuilder->GetBuiltAssetsPath() + imgDef.assetInfo->path;
-		imgData.SaveToFile(imageFullPath);
+		imgData.SaveToFile(imageFullPath, mAssetsBuilder->GetBuiltDataFormat());
 		o2FileSystem.SetFileEditDate(imageFullPath, imgDef.assetInfo->editTime);
 
 		DataDocument metaData;
@@ -303,8 +364,17 @@ namespace o2
 		metaData.SaveToFile(mAssetsBuilder->GetSourceAssetsPath() + imgDef.assetInfo->path + ".meta");
 	}
 
+	UInt64 AtlasAssetConverter::GetBitmapHash(Bitmap* bitmap)
+	{
+		Vec2I size = bitmap->GetSize();
+		int bpp = bitmap->GetFormat() == PixelFormat::R8G8B8A8 ? 4 : 3;
+
+		UInt64 hash = AssetsBuilder::GetDataHash(&size, sizeof(size));
+		return AssetsBuilder::HashCombine(hash, AssetsBuilder::GetDataHash(bitmap->GetData(), size.x*size.y*bpp));
+	}
+
 	AtlasAssetConverter::Image::Image(const UID& id, const TimeStamp& time):
-		id(id), time(time)
+		id(id), time(time), hash(0)
 	{}
 
 	bool AtlasAssetConverter::Image::operator==(const Image& other) const
@@ -321,3 +391,10 @@ namespace o2
 DECLARE_CLASS(o2::AtlasAssetConverter);
 
 DECLARE_CLASS(o2::AtlasAssetConverter::Image);
+CLASS_SERIALIZATION_META(o2::AtlasAssetConverter::Image)
+{
+	SERIALIZABLE_FIELD(id);
+	SERIALIZABLE_FIELD(time);
+	SERIALIZABLE_FIELD(hash);
+}
+END_META;
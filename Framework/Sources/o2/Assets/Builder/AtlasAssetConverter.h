@@ -42,10 +42,11 @@ namespace o2
 		{
 			UID       id;   // Image asset id @SERIALIZABLE
 			TimeStamp time; // Image asset edited date @SERIALIZABLE
+			UInt64    hash; // Image bitmap content hash @SERIALIZABLE
 
 		public:
 			// Default constructor
-			Image() {}
+			Image(): hash(0) {}
 
 			// Constructor
 			Image(const UID& id, const TimeStamp& time);
@@ -63,7 +64,8 @@ namespace o2
 		{
 			Bitmap*                bitmap = nullptr;    // Image bitmap pointer
 			RectsPacker::Rect*     packRect = nullptr;  // Image pack rectangle pointer
-			AssetInfo* assetInfo = nullptr; // Asset information
+			AssetInfo*             assetInfo = nullptr; // Asset information
+			UInt64                 hash = 0;            // Image bitmap content hash
 
 			// Check equal operator
 			bool operator==(const ImagePackDef& other) const;
@@ -87,6 +89,9 @@ namespace o2
 
 		// Saves image asset data
 		void SaveImageAsset(ImagePackDef& imgDef);
+
+		// Returns hash of bitmap size and pixels
+		static UInt64 GetBitmapHash(Bitmap* bitmap);
 	};
 }
 
@@ -126,6 +131,7 @@ CLASS_FIELDS_META(o2::AtlasAssetConverter::Image)
 {
 	PUBLIC_FIELD(id).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(time).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(hash).SERIALIZABLE_ATTRIBUTE();
 }
 END_META;
 CLASS_METHODS_META(o2::AtlasAssetConverter::Image)
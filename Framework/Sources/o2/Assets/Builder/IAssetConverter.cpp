@@ -27,6 +27,11 @@ namespace o2
 	void IAssetConverter::Reset()
 	{}
 
+	int IAssetConverter::GetVersion() const
+	{
+		return 1;
+	}
+
 	void IAssetConverter::SetAssetsBuilder(AssetsBuilder* builder)
 	{
 		mAssetsBuilder = builder;
@@ -38,6 +38,9 @@ namespace o2
 		// Resets converter
 		virtual void Reset();
 
+		// Returns converter version. Increase it when converting result changes, assets will be converted again
+		virtual int GetVersion() const;
+
 		// Sets owner assets builder
 		void SetAssetsBuilder(AssetsBuilder* builder);
 
@@ -68,6 +71,7 @@ CLASS_METHODS_META(o2::IAssetConverter)
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
 	PUBLIC_FUNCTION(Vector<UID>, AssetsPostProcess);
 	PUBLIC_FUNCTION(void, Reset);
+	PUBLIC_FUNCTION(int, GetVersion);
 	PUBLIC_FUNCTION(void, SetAssetsBuilder, AssetsBuilder*);
 }
 END_META;
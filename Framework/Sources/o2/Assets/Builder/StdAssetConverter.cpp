@@ -2,8 +2,11 @@
 #include "StdAssetConverter.h"
 
 #include "o2/Assets/Assets.h"
+#include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Assets/Types/AnimationAsset.h"
 #include "o2/Assets/Types/BinaryAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/DataAsset.h"
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 
@@ -21,7 +24,12 @@ namespace o2
 		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
 		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
 
-		o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+		bool converted = mAssetsBuilder->IsBinaryDataFormat() && IsDataAsset(node.meta->GetAssetType()) &&
+			AssetsBuilder::ConvertDataFile(sourceAssetPath, buildedAssetPath, DataDocument::Format::Binary);
+
+		if (!converted)
+			o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+
 		o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
 	}
 
@@ -39,6 +47,12 @@ namespace o2
 
 		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
 	}
+
+	bool StdAssetConverter::IsDataAsset(const Type* assetType) const
+	{
+		return assetType->IsBasedOn(TypeOf(ActorAsset)) || assetType->IsBasedOn(TypeOf(AnimationAsset)) ||
+			assetType->IsBasedOn(TypeOf(DataAsset));
+	}
 }
 
 DECLARE_CLASS(o2::StdAssetConverter);
@@ -4,9 +4,10 @@
 
 namespace o2
 {
-	// -----------------------------------------------------------------
-	// Standard assets converter. Copying file and meta without changing
-	// -----------------------------------------------------------------
+	// -------------------------------------------------------------------------------------
+	// Standard assets converter. Copying file and meta without changing. Data assets are
+	// converted into binary format when assets builder is configured for binary data format
+	// -------------------------------------------------------------------------------------
 	class StdAssetConverter: public IAssetConverter
 	{
 	public:
@@ -23,6 +24,10 @@ namespace o2
 		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
 		IOBJECT(StdAssetConverter);
+
+	protected:
+		// Returns true when asset type is stored as data document
+		bool IsDataAsset(const Type* assetType) const;
 	};
 }
 
@@ -42,5 +47,6 @@ CLASS_METHODS_META(o2::StdAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PROTECTED_FUNCTION(bool, IsDataAsset, const Type*);
 }
 END_META;
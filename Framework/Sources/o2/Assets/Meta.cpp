@@ -27,3 +27,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::AssetMeta);
+CLASS_SERIALIZATION_META(o2::AssetMeta)
+{
+	SERIALIZABLE_FIELD(mId);
+}
+END_META;
@@ -26,6 +26,7 @@ namespace o2
 	{
 		Asset::operator=(other);
 		*mActor = *other.mActor;
+		mClonePlan.Clear();
 
 		return *this;
 	}
@@ -44,6 +45,19 @@ namespace o2
 	{
 		return mActor;
 	}
+
+	const ActorClonePlan& ActorAsset::GetClonePlan() const
+	{
+		if (!mClonePlan.IsMatching(mActor))
+			mClonePlan.Build(mActor);
+
+		return mClonePlan;
+	}
+
+	void ActorAsset::OnDeserialized(const DataValue& node)
+	{
+		mClonePlan.Clear();
+	}
 }
 
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::ActorAsset>);
@@ -51,3 +65,8 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::ActorAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ActorAsset>);
 
 DECLARE_CLASS(o2::ActorAsset);
+CLASS_SERIALIZATION_META(o2::ActorAsset)
+{
+	SERIALIZABLE_FIELD(mActor);
+}
+END_META;
@@ -2,6 +2,7 @@
 
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetRef.h"
+#include "o2/Scene/ActorClonePlan.h"
 
 namespace o2
 {
@@ -31,6 +32,9 @@ namespace o2
 		// Returns actor
 		Actor* GetActor() const;
 
+		// Returns actor copying plan, rebuilds it when actor's hierarchy was changed
+		const ActorClonePlan& GetClonePlan() const;
+
 		// Returns extensions string
 		static const char* GetFileExtensions();
 
@@ -48,6 +52,12 @@ namespace o2
 	protected:
 		Actor* mActor; // Asset data @SERIALIZABLE
 
+		mutable ActorClonePlan mClonePlan; // Cached actor copying plan, used for instantiating
+
+	protected:
+		// Completion deserialization callback, resets clone plan
+		void OnDeserialized(const DataValue& node) override;
+
 		friend class Assets;
 	};
 
@@ -62,6 +72,7 @@ END_META;
 CLASS_FIELDS_META(o2::ActorAsset)
 {
 	PROTECTED_FIELD(mActor).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mClonePlan);
 }
 END_META;
 CLASS_METHODS_META(o2::ActorAsset)
@@ -69,9 +80,11 @@ CLASS_METHODS_META(o2::ActorAsset)
 
 	PUBLIC_FUNCTION(Meta*, GetMeta);
 	PUBLIC_FUNCTION(Actor*, GetActor);
+	PUBLIC_FUNCTION(const ActorClonePlan&, GetClonePlan);
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(String, GetEditorIcon);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
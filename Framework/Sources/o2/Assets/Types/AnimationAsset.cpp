@@ -32,3 +32,8 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::AnimationAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::AnimationAsset>);
 
 DECLARE_CLASS(o2::AnimationAsset);
+CLASS_SERIALIZATION_META(o2::AnimationAsset)
+{
+	SERIALIZABLE_FIELD(animation);
+}
+END_META;
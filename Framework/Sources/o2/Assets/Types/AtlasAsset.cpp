@@ -134,9 +134,37 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::AtlasAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::AtlasAsset>);
 
 DECLARE_CLASS(o2::AtlasAsset);
+CLASS_SERIALIZATION_META(o2::AtlasAsset)
+{
+	SERIALIZABLE_FIELD(mImages);
+	SERIALIZABLE_FIELD(mPages);
+}
+END_META;
 
 DECLARE_CLASS(o2::AtlasAsset::PlatformMeta);
+CLASS_SERIALIZATION_META(o2::AtlasAsset::PlatformMeta)
+{
+	SERIALIZABLE_FIELD_DEFAULT(maxSize, Vec2I(2048, 2048));
+	SERIALIZABLE_FIELD(format);
+}
+END_META;
 
 DECLARE_CLASS(o2::AtlasAsset::Meta);
+CLASS_SERIALIZATION_META(o2::AtlasAsset::Meta)
+{
+	SERIALIZABLE_FIELD(ios);
+	SERIALIZABLE_FIELD(android);
+	SERIALIZABLE_FIELD(macOS);
+	SERIALIZABLE_FIELD(windows);
+	SERIALIZABLE_FIELD(border);
+}
+END_META;
 
 DECLARE_CLASS(o2::AtlasAsset::Page);
+CLASS_SERIALIZATION_META(o2::AtlasAsset::Page)
+{
+	SERIALIZABLE_FIELD(mId);
+	SERIALIZABLE_FIELD(mSize);
+	SERIALIZABLE_FIELD(mImagesRects);
+}
+END_META;
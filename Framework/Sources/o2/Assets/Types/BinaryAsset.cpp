@@ -97,6 +97,23 @@ namespace o2
 		file.ReadFullData(mData);
 	}
 
+	void BinaryAsset::PrepareLoadData(const String& path)
+	{
+		InFile file(path);
+		if (!file.IsOpened())
+			return;
+
+		mDataSize = file.GetDataSize();
+		mData = mnew char[mDataSize];
+		file.ReadFullData(mData);
+	}
+
+	void BinaryAsset::CompleteLoadData(const String& path)
+	{
+		if (!mData)
+			GetAssetsLogStream()->Error("Failed to load binary asset data: can't open file " + path);
+	}
+
 	void BinaryAsset::SaveData(const String& path) const
 	{
 		OutFile file(path);
@@ -110,3 +127,7 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BinaryAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BinaryAsset>);
 
 DECLARE_CLASS(o2::BinaryAsset);
+CLASS_SERIALIZATION_META(o2::BinaryAsset)
+{
+}
+END_META;
@@ -55,6 +55,12 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
+		// Reads file data on worker thread
+		void PrepareLoadData(const String& path) override;
+
+		// Checks that data was read
+		void CompleteLoadData(const String& path) override;
+
 		friend class Assets;
 	};
 
@@ -84,5 +90,7 @@ CLASS_METHODS_META(o2::BinaryAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
+	PROTECTED_FUNCTION(void, CompleteLoadData, const String&);
 }
 END_META;
@@ -39,10 +39,26 @@ namespace o2
 		if (!mFont)
 			mFont = mnew BitmapFont(path);
 	}
+
+	void BitmapFontAsset::PrepareLoadData(const String& path)
+	{}
+
+	void BitmapFontAsset::CompleteLoadData(const String& path)
+	{
+		LoadData(path);
+	}
 }
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BitmapFontAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BitmapFontAsset>);
 
 DECLARE_CLASS(o2::BitmapFontAsset);
+CLASS_SERIALIZATION_META(o2::BitmapFontAsset)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::BitmapFontAsset::Meta);
+CLASS_SERIALIZATION_META(o2::BitmapFontAsset::Meta)
+{
+}
+END_META;
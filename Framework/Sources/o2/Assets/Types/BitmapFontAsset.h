@@ -53,6 +53,12 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Fonts are loaded on main thread, does nothing
+		void PrepareLoadData(const String& path) override;
+
+		// Loads font on main thread
+		void CompleteLoadData(const String& path) override;
+
 		friend class Assets;
 	};
 
@@ -76,6 +82,8 @@ CLASS_METHODS_META(o2::BitmapFontAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
+	PROTECTED_FUNCTION(void, CompleteLoadData, const String&);
 }
 END_META;
 
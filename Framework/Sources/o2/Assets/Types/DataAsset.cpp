@@ -35,6 +35,14 @@ namespace o2
 	{
 		data.SaveToFile(path);
 	}
+
+	void DataAsset::PrepareLoadData(const String& path)
+	{
+		LoadData(path);
+	}
+
+	void DataAsset::CompleteLoadData(const String& path)
+	{}
 }
 
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::DataAsset>);
@@ -42,3 +50,7 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::DataAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::DataAsset>);
 
 DECLARE_CLASS(o2::DataAsset);
+CLASS_SERIALIZATION_META(o2::DataAsset)
+{
+}
+END_META;
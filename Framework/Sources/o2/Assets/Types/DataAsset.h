@@ -44,6 +44,12 @@ namespace o2
 		// Saves data
 		void SaveData(const String& path) const override;
 
+		// Loads data on worker thread
+		void PrepareLoadData(const String& path) override;
+
+		// Data is already loaded in PrepareLoadData, does nothing
+		void CompleteLoadData(const String& path) override;
+
 		friend class Assets;
 	};
 
@@ -69,5 +75,7 @@ CLASS_METHODS_META(o2::DataAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
+	PROTECTED_FUNCTION(void, CompleteLoadData, const String&);
 }
 END_META;
@@ -31,6 +31,12 @@ namespace o2
 	void FolderAsset::LoadData(const String& path)
 	{}
 
+	void FolderAsset::PrepareLoadData(const String& path)
+	{}
+
+	void FolderAsset::CompleteLoadData(const String& path)
+	{}
+
 	void FolderAsset::SaveData(const String& path) const
 	{
 		if (!o2FileSystem.IsFolderExist(path))
@@ -43,3 +49,7 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::FolderAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::FolderAsset>);
 
 DECLARE_CLASS(o2::FolderAsset);
+CLASS_SERIALIZATION_META(o2::FolderAsset)
+{
+}
+END_META;
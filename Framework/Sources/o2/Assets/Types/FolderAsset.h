@@ -40,6 +40,12 @@ namespace o2
 		// Saves asset data
 		void SaveData(const String& path) const override;
 
+		// Folder hasn't data, does nothing
+		void PrepareLoadData(const String& path) override;
+
+		// Folder hasn't data, does nothing
+		void CompleteLoadData(const String& path) override;
+
 		friend class Assets;
 	};
 
@@ -64,5 +70,7 @@ CLASS_METHODS_META(o2::FolderAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
+	PROTECTED_FUNCTION(void, CompleteLoadData, const String&);
 }
 END_META;
@@ -34,3 +34,7 @@ namespace o2
 DECLARE_CLASS_MANUAL(o2::Ref<o2::FontAsset>);
 
 DECLARE_CLASS(o2::FontAsset);
+CLASS_SERIALIZATION_META(o2::FontAsset)
+{
+}
+END_META;
@@ -155,6 +155,17 @@ namespace o2
 		mBitmap->Load(assetFullPath);
 	}
 
+	void ImageAsset::PrepareLoadData(const String& path)
+	{
+		Asset::PrepareLoadData(path);
+
+		if (auto pageData = mPreparedData->FindMember("mAtlasPage"))
+		{
+			UInt page = *pageData;
+			o2Assets.PrepareAsyncTexture(AtlasAsset::GetPageTextureFileName(o2Assets.GetAssetInfo(GetAtlas()), page));
+		}
+	}
+
 	bool ImageAsset::PlatformMeta::operator==(const PlatformMeta& other) const
 	{
 		return maxSize == other.maxSize && format == other.format && scale == other.scale;
@@ -176,7 +187,31 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::ImageAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ImageAsset>);
 
 DECLARE_CLASS(o2::ImageAsset);
+CLASS_SERIALIZATION_META(o2::ImageAsset)
+{
+	SERIALIZABLE_FIELD(mAtlasPage);
+	SERIALIZABLE_FIELD(mAtlasRect);
+}
+END_META;
 
 DECLARE_CLASS(o2::ImageAsset::PlatformMeta);
+CLASS_SERIALIZATION_META(o2::ImageAsset::PlatformMeta)
+{
+	SERIALIZABLE_FIELD(maxSize);
+	SERIALIZABLE_FIELD(scale);
+	SERIALIZABLE_FIELD(format);
+}
+END_META;
 
 DECLARE_CLASS(o2::ImageAsset::Meta);
+CLASS_SERIALIZATION_META(o2::ImageAsset::Meta)
+{
+	SERIALIZABLE_FIELD_DEFAULT(atlasId, UID::empty);
+	SERIALIZABLE_FIELD(ios);
+	SERIALIZABLE_FIELD(android);
+	SERIALIZABLE_FIELD(macOS);
+	SERIALIZABLE_FIELD(windows);
+	SERIALIZABLE_FIELD(sliceBorder);
+	SERIALIZABLE_FIELD(defaultMode);
+}
+END_META;
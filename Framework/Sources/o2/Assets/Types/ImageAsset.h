@@ -144,6 +144,9 @@ namespace o2
 		// Load bitmap
 		void LoadBitmap();
 
+		// Parses data and decodes atlas page texture on worker thread
+		void PrepareLoadData(const String& path) override;
+
 		friend class AtlasAsset;
 		friend class Assets;
 	};
@@ -194,6 +197,7 @@ CLASS_METHODS_META(o2::ImageAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
 	PROTECTED_FUNCTION(void, LoadBitmap);
+	PROTECTED_FUNCTION(void, PrepareLoadData, const String&);
 }
 END_META;
 
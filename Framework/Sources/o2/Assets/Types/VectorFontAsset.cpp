@@ -108,6 +108,14 @@ namespace o2
 		GetMeta()->mAsset = this;
 	}
 
+	void VectorFontAsset::PrepareLoadData(const String& path)
+	{}
+
+	void VectorFontAsset::CompleteLoadData(const String& path)
+	{
+		LoadData(path);
+	}
+
 	void VectorFontAsset::SaveData(const String& path) const
 	{}
 
@@ -128,5 +136,14 @@ DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::VectorFontAsset>);
 DECLARE_CLASS_MANUAL(o2::Ref<o2::VectorFontAsset>);
 
 DECLARE_CLASS(o2::VectorFontAsset);
+CLASS_SERIALIZATION_META(o2::VectorFontAsset)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::VectorFontAsset::Meta);
+CLASS_SERIALIZATION_META(o2::VectorFontAsset::Meta)
+{
+	SERIALIZABLE_FIELD(mEffects);
+}
+END_META;
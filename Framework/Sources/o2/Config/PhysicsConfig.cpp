@@ -2,3 +2,12 @@
 #include "PhysicsConfig.h"
 
 DECLARE_CLASS(o2::PhysicsConfig);
+CLASS_SERIALIZATION_META(o2::PhysicsConfig)
+{
+	SERIALIZABLE_FIELD_DEFAULT(gravity, Vec2F(0, -98.0f));
+	SERIALIZABLE_FIELD_DEFAULT(scale, 10.0f);
+	SERIALIZABLE_FIELD_DEFAULT(velocityIterations, 8);
+	SERIALIZABLE_FIELD_DEFAULT(positionIterations, 3);
+	SERIALIZABLE_FIELD_DEFAULT(debugDrawAlpha, 0.5f);
+}
+END_META;
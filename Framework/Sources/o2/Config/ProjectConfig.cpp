@@ -45,3 +45,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ProjectConfig);
+CLASS_SERIALIZATION_META(o2::ProjectConfig)
+{
+	SERIALIZABLE_FIELD(physics);
+	SERIALIZABLE_FIELD(mProjectName);
+}
+END_META;
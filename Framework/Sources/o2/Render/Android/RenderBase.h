@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef PLATFORM_ANDROID
+#if defined PLATFORM_ANDROID && !defined RENDER_HEADLESS
 
 #include "Render/Android/OpenGL.h"
 
@@ -1,6 +1,6 @@
 #include "stdafx.h"
 
-#ifdef PLATFORM_ANDROID
+#if defined PLATFORM_ANDROID && !defined RENDER_HEADLESS
 
 #include "Render/Render.h"
 
@@ -246,6 +246,7 @@ namespace o2
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mDIPCountBeforeReordering = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -266,6 +267,8 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		FlushDeferredBuffers();
+
 		if (mLastDrawVertex < 1)
 			return;
 
@@ -521,17 +524,9 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							  UInt16* indexes, UInt elementsCount, const TextureRef& texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
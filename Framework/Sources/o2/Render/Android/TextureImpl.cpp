@@ -1,6 +1,6 @@
 #include "stdafx.h"
 
-#ifdef PLATFORM_ANDROID
+#if defined PLATFORM_ANDROID && !defined RENDER_HEADLESS
 #include "Render/Texture.h"
 #include "Utils/Debug/Log/LogStream.h"
 
@@ -118,6 +118,8 @@ namespace o2
 
 	void Texture::SetData(Bitmap* bitmap)
 	{
+		o2Render.DrawPrimitives();
+
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
 		GLint texFormat = GL_RGB;
@@ -134,6 +136,8 @@ namespace o2
 
 	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
 	{
+		o2Render.DrawPrimitives();
+
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
 		GLint texFormat = GL_RGB;
@@ -150,6 +154,8 @@ namespace o2
 
 	void Texture::Copy(const Texture& from, const RectI& rect)
 	{
+		o2Render.DrawPrimitives();
+
 		glBindTexture(GL_TEXTURE_2D, from.mHandle);
 
 		GLint texFormat = GL_RGB;
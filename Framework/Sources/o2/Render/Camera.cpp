@@ -71,3 +71,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Camera);
+CLASS_SERIALIZATION_META(o2::Camera)
+{
+}
+END_META;
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifdef RENDER_HEADLESS
+
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Bitmap;
+	class Texture;
+	class Vertex2;
+
+	// ---------------------------------------------------------------------------------------------
+	// Headless render base. Doesn't need window or GPU, records every sent batch and can rasterize
+	// batches in software into bitmap. Enabled by RENDER_HEADLESS define instead of platform render
+	// ---------------------------------------------------------------------------------------------
+	class RenderBase
+	{
+	public:
+		// --------------------------------
+		// Recorded draw batch of one frame
+		// --------------------------------
+		struct DrawBatch
+		{
+			const Texture* texture = nullptr;                     // Batch texture, nullptr when drawing without texture
+			const Texture* renderTarget = nullptr;                // Render target texture, nullptr when drawing into frame
+			PrimitiveType  primitiveType = PrimitiveType::Polygon; // Batch primitive type
+			UInt           verticesCount = 0;                     // Count of vertices in batch
+			UInt           indexesCount = 0;                      // Count of indexes in batch
+			bool           scissorTest = false;                   // Is scissor test enabled
+			RectI          scissorRect;                           // Screen space scissor rectangle, valid when scissor test enabled
+			bool           stencilDrawing = false;                // Is batch drawn into stencil buffer
+			bool           stencilTest = false;                   // Is stencil test enabled
+		};
+
+	public:
+		// Returns batches recorded since frame beginning
+		const Vector<DrawBatch>& GetRecordedBatches() const;
+
+		// Sets is batches recording enabled. It is enabled by default
+		void SetBatchesRecording(bool enabled);
+
+		// Returns is batches recording enabled
+		bool IsBatchesRecording() const;
+
+		// Sets frame bitmap for software rasterization. Bitmap must be R8G8B8A8 with render resolution,
+		// rows are stored from bottom to top as in OpenGL frame buffer. nullptr disables rasterization
+		void SetRasterizationTarget(Bitmap* bitmap);
+
+		// Returns frame bitmap for software rasterization
+		Bitmap* GetRasterizationTarget() const;
+
+		// Sets frame resolution, used when there is no application window
+		void SetFrameResolution(const Vec2I& resolution);
+
+	protected:
+		UInt8*  mVertexData;               // Vertex data buffer
+		UInt16* mVertexIndexData;          // Index data buffer
+		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
+		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		Vector<DrawBatch> mRecordedBatches;         // Recorded batches at current frame
+		bool              mBatchesRecording = true; // Is recording batches enabled
+
+		Bitmap* mRasterizationTarget = nullptr; // Software rasterization frame bitmap. nullptr when rasterization is disabled
+
+		Basis mViewTransform;                  // World to frame center space transformation, depends on camera
+		bool  mScissorTestEnabled = false;     // Is scissor test enabled
+		RectI mScreenScissorRect;              // Screen space scissor rectangle, from left bottom frame corner
+
+	protected:
+		// Sets screen scissor rectangle from screen space rectangle with center origin
+		void SetScreenScissorRect(const RectI& screenSpaceRect, const Vec2I& resolution);
+
+		// Rasterizes triangle into bitmap
+		void RasterizeTriangle(Bitmap* target, const Texture* texture, const Vertex2& a, const Vertex2& b, const Vertex2& c);
+
+		// Rasterizes line into bitmap
+		void RasterizeLine(Bitmap* target, const Vertex2& a, const Vertex2& b);
+
+		// Blends color into target pixel, checks scissor and bitmap bounds
+		void BlendPixel(Bitmap* target, int x, int y, const Color4& color);
+
+		// Returns texture color by texture coordinates
+		Color4 SampleTexture(const Texture* texture, float u, float v) const;
+	};
+};
+
+#endif // RENDER_HEADLESS
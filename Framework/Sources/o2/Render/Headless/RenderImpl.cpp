@@ -0,0 +1,614 @@
+#include "o2/stdafx.h"
+
+#ifdef RENDER_HEADLESS
+#include "o2/Render/Render.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Assets/Assets.h"
+#include "o2/Render/Font.h"
+#include "o2/Render/Mesh.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+
+namespace o2
+{
+	Render::Render():
+		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
+	{
+		mVertexBufferSize = USHRT_MAX;
+		mIndexBufferSize = USHRT_MAX;
+
+		// Create log stream
+		mLog = mnew LogStream("Render");
+		o2Debug.GetLog()->BindStream(mLog);
+
+		mLog->Out("Initializing headless render..");
+
+		// There is no window in tests and benchmarks, resolution is set by SetFrameResolution()
+		if (Application::IsSingletonInitialzed())
+			mResolution = o2Application.GetContentSize();
+
+		mDPI = Vec2I(96, 96);
+
+		CheckCompatibles();
+
+		// Initialize buffers
+		mVertexData = mnew UInt8[mVertexBufferSize*sizeof(Vertex2)];
+
+		mVertexIndexData = mnew UInt16[mIndexBufferSize];
+		mLastDrawVertex = 0;
+		mTrianglesCount = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		InitializeFreeType();
+		InitializeLinesIndexBuffer();
+		InitializeLinesTextures();
+
+		mCurrentRenderTarget = TextureRef();
+
+		if (IsDevMode() && Assets::IsSingletonInitialzed())
+			o2Assets.onAssetsRebuilt += MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		mReady = true;
+	}
+
+	Render::~Render()
+	{
+		if (!mReady)
+			return;
+
+		if (IsDevMode() && Assets::IsSingletonInitialzed())
+			o2Assets.onAssetsRebuilt -= MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		mSolidLineTexture = TextureRef::Null();
+		mDashLineTexture = TextureRef::Null();
+
+		auto fonts = mFonts;
+		for (auto font : fonts)
+			delete font;
+
+		auto textures = mTextures;
+		for (auto texture : textures)
+			delete texture;
+
+		delete[] mVertexData;
+		delete[] mVertexIndexData;
+
+		DeinitializeFreeType();
+
+		mReady = false;
+	}
+
+	void Render::CheckCompatibles()
+	{
+		mRenderTargetsAvailable = true;
+		mMaxTextureSize = Vec2I(8192, 8192);
+	}
+
+	void Render::Begin()
+	{
+		if (!mReady)
+			return;
+
+		mLastDrawTexture = NULL;
+		mLastDrawVertex = 0;
+		mLastDrawIdx = 0;
+		mTrianglesCount = 0;
+		mFrameTrianglesCount = 0;
+		mDIPCount = 0;
+		mDIPCountBeforeReordering = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		mDrawingDepth = 0.0f;
+
+		mScissorInfos.Clear();
+		mStackScissors.Clear();
+		mRecordedBatches.Clear();
+
+		mClippingEverything = false;
+		mScissorTestEnabled = false;
+
+		SetupViewMatrix(mResolution);
+		UpdateCameraTransforms();
+
+		preRender();
+		preRender.Clear();
+	}
+
+	void Render::DrawPrimitives()
+	{
+		FlushDeferredBuffers();
+
+		if (mLastDrawVertex < 1)
+			return;
+
+		if (mBatchesRecording)
+		{
+			DrawBatch batch;
+			batch.texture = mLastDrawTexture;
+			batch.renderTarget = mCurrentRenderTarget.Get();
+			batch.primitiveType = mCurrentPrimitiveType;
+			batch.verticesCount = mLastDrawVertex;
+			batch.indexesCount = mLastDrawIdx;
+			batch.scissorTest = mScissorTestEnabled;
+			batch.scissorRect = mScreenScissorRect;
+			batch.stencilDrawing = mStencilDrawing;
+			batch.stencilTest = mStencilTest;
+
+			mRecordedBatches.Add(batch);
+		}
+
+		// Stencil buffer isn't emulated, drawing into stencil doesn't change colors
+		Bitmap* target = mCurrentRenderTarget ? mCurrentRenderTarget->mPixels : mRasterizationTarget;
+		if (target && !mStencilDrawing)
+		{
+			Vec2F offset(Math::Round(mCurrentResolution.x*0.5f), mCurrentResolution.y - Math::Round(mCurrentResolution.y*0.5f));
+
+			Vertex2* vertices = (Vertex2*)mVertexData;
+			for (UInt i = 0; i < mLastDrawVertex; i++)
+			{
+				Vec2F framePoint = Vec2F(vertices[i].x, vertices[i].y)*mViewTransform + offset;
+				vertices[i].x = framePoint.x;
+				vertices[i].y = framePoint.y;
+			}
+
+			if (mCurrentPrimitiveType == PrimitiveType::Line)
+			{
+				for (UInt i = 0; i + 1 < mLastDrawIdx; i += 2)
+					RasterizeLine(target, vertices[mVertexIndexData[i]], vertices[mVertexIndexData[i + 1]]);
+			}
+			else
+			{
+				for (UInt i = 0; i + 2 < mLastDrawIdx; i += 3)
+				{
+					const Vertex2& a = vertices[mVertexIndexData[i]];
+					const Vertex2& b = vertices[mVertexIndexData[i + 1]];
+					const Vertex2& c = vertices[mVertexIndexData[i + 2]];
+
+					if (mCurrentPrimitiveType == PrimitiveType::PolygonWire)
+					{
+						RasterizeLine(target, a, b);
+						RasterizeLine(target, b, c);
+						RasterizeLine(target, c, a);
+					}
+					else
+						RasterizeTriangle(target, mLastDrawTexture, a, b, c);
+				}
+			}
+		}
+
+		mFrameTrianglesCount += mTrianglesCount;
+		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
+
+		mDIPCount++;
+	}
+
+	void Render::SetupViewMatrix(const Vec2I& viewSize)
+	{
+		mCurrentResolution = viewSize;
+		mCamera = Camera();
+
+		UpdateCameraTransforms();
+	}
+
+	void Render::End()
+	{
+		if (!mReady)
+			return;
+
+		postRender();
+		postRender.Clear();
+
+		DrawPrimitives();
+
+		CheckTexturesUnloading();
+		CheckFontsUnloading();
+	}
+
+	void Render::Clear(const Color4& color /*= Color4::Blur()*/)
+	{
+		Bitmap* target = mCurrentRenderTarget ? mCurrentRenderTarget->mPixels : mRasterizationTarget;
+		if (target)
+			target->Fill(color);
+	}
+
+	void Render::UpdateCameraTransforms()
+	{
+		DrawPrimitives();
+
+		Vec2F resf = (Vec2F)mCurrentResolution;
+
+		Basis defaultCameraBasis((Vec2F)mCurrentResolution*-0.5f, Vec2F::Right()*resf.x, Vec2F().Up()*resf.y);
+		Basis camTransf = mCamera.GetBasis().Inverted()*defaultCameraBasis;
+		mViewScale = Vec2F(camTransf.xv.Length(), camTransf.yv.Length());
+		mInvViewScale = Vec2F(1.0f / mViewScale.x, 1.0f / mViewScale.y);
+
+		mViewTransform = camTransf;
+	}
+
+	void Render::BeginRenderToStencilBuffer()
+	{
+		if (mStencilDrawing || mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mStencilDrawing = true;
+	}
+
+	void Render::EndRenderToStencilBuffer()
+	{
+		if (!mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mStencilDrawing = false;
+	}
+
+	void Render::EnableStencilTest()
+	{
+		if (mStencilTest || mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mStencilTest = true;
+	}
+
+	void Render::DisableStencilTest()
+	{
+		if (!mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mStencilTest = false;
+	}
+
+	void Render::ClearStencil()
+	{}
+
+	void Render::EnableScissorTest(const RectI& rect)
+	{
+		DrawPrimitives();
+
+		RectI summaryScissorRect = rect;
+		if (!mStackScissors.IsEmpty())
+		{
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+
+			if (!mStackScissors.Last().mRenderTarget)
+			{
+				RectI lastSummaryClipRect = mStackScissors.Last().mSummaryScissorRect;
+				mClippingEverything = !summaryScissorRect.IsIntersects(lastSummaryClipRect);
+				summaryScissorRect = summaryScissorRect.GetIntersection(lastSummaryClipRect);
+			}
+			else
+			{
+				mScissorTestEnabled = true;
+				mClippingEverything = false;
+			}
+		}
+		else
+		{
+			mScissorTestEnabled = true;
+			mClippingEverything = false;
+		}
+
+		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
+		mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
+
+		SetScreenScissorRect(CalculateScreenSpaceScissorRect(summaryScissorRect), mCurrentResolution);
+	}
+
+	void Render::DisableScissorTest(bool forcible /*= false*/)
+	{
+		if (mStackScissors.IsEmpty())
+		{
+			mLog->WarningStr("Can't disable scissor test - no scissor were enabled!");
+			return;
+		}
+
+		DrawPrimitives();
+
+		if (forcible)
+		{
+			mScissorTestEnabled = false;
+
+			while (!mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget)
+				mStackScissors.PopBack();
+
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+		}
+		else
+		{
+			if (mStackScissors.Count() == 1)
+			{
+				mScissorTestEnabled = false;
+				mStackScissors.PopBack();
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mClippingEverything = false;
+			}
+			else
+			{
+				mStackScissors.PopBack();
+				RectI lastClipRect = mStackScissors.Last().mSummaryScissorRect;
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mScissorInfos.Add(ScissorInfo(lastClipRect, mDrawingDepth));
+
+				if (mStackScissors.Last().mRenderTarget)
+				{
+					mScissorTestEnabled = false;
+					mClippingEverything = false;
+				}
+				else
+				{
+					SetScreenScissorRect(CalculateScreenSpaceScissorRect(lastClipRect), mCurrentResolution);
+					mClippingEverything = lastClipRect == RectI();
+				}
+			}
+		}
+	}
+
+	void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							  UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		UInt indexesCount;
+		if (primitiveType == PrimitiveType::Line)
+			indexesCount = elementsCount * 2;
+		else
+			indexesCount = elementsCount * 3;
+
+		if (mLastDrawTexture != texture.mTexture ||
+			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
+			mCurrentPrimitiveType != primitiveType)
+		{
+			DrawPrimitives();
+
+			mLastDrawTexture = texture.mTexture;
+			mCurrentPrimitiveType = primitiveType;
+		}
+
+		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
+
+		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
+			mVertexIndexData[i] = mLastDrawVertex + indexes[j];
+
+		if (primitiveType != PrimitiveType::Line)
+			mTrianglesCount += elementsCount;
+
+		mLastDrawVertex += verticesCount;
+		mLastDrawIdx += indexesCount;
+	}
+
+	void Render::BindRenderTexture(TextureRef renderTarget)
+	{
+		if (!renderTarget)
+		{
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (renderTarget->mUsage != Texture::Usage::RenderTarget)
+		{
+			mLog->Error("Can't set texture as render target: not render target texture");
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (!renderTarget->IsReady())
+		{
+			mLog->Error("Can't set texture as render target: texture isn't ready");
+			UnbindRenderTexture();
+			return;
+		}
+
+		DrawPrimitives();
+
+		if (!mStackScissors.IsEmpty())
+		{
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+			mScissorTestEnabled = false;
+		}
+
+		mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
+
+		SetupViewMatrix(renderTarget->GetSize());
+
+		mCurrentRenderTarget = renderTarget;
+	}
+
+	void Render::UnbindRenderTexture()
+	{
+		if (!mCurrentRenderTarget)
+			return;
+
+		DrawPrimitives();
+
+		SetupViewMatrix(mResolution);
+
+		mCurrentRenderTarget = TextureRef();
+
+		DisableScissorTest(true);
+		mStackScissors.PopBack();
+		if (!mStackScissors.IsEmpty())
+		{
+			mScissorTestEnabled = true;
+
+			auto clipRect = mStackScissors.Last().mSummaryScissorRect;
+			SetScreenScissorRect(clipRect, mCurrentResolution);
+
+			mClippingEverything = clipRect == RectI();
+		}
+	}
+
+	const Vector<RenderBase::DrawBatch>& RenderBase::GetRecordedBatches() const
+	{
+		return mRecordedBatches;
+	}
+
+	void RenderBase::SetBatchesRecording(bool enabled)
+	{
+		mBatchesRecording = enabled;
+	}
+
+	bool RenderBase::IsBatchesRecording() const
+	{
+		return mBatchesRecording;
+	}
+
+	void RenderBase::SetRasterizationTarget(Bitmap* bitmap)
+	{
+		if (bitmap && bitmap->GetFormat() != PixelFormat::R8G8B8A8)
+		{
+			o2Debug.LogWarning("Can't use bitmap as rasterization target: only R8G8B8A8 format is supported");
+			return;
+		}
+
+		mRasterizationTarget = bitmap;
+	}
+
+	Bitmap* RenderBase::GetRasterizationTarget() const
+	{
+		return mRasterizationTarget;
+	}
+
+	void RenderBase::SetFrameResolution(const Vec2I& resolution)
+	{
+		Render* render = static_cast<Render*>(this);
+		render->mResolution = resolution;
+
+		if (!render->mCurrentRenderTarget)
+			render->SetupViewMatrix(resolution);
+	}
+
+	void RenderBase::SetScreenScissorRect(const RectI& screenSpaceRect, const Vec2I& resolution)
+	{
+		int left = (int)(screenSpaceRect.left + resolution.x*0.5f);
+		int bottom = (int)(screenSpaceRect.bottom + resolution.y*0.5f);
+
+		mScreenScissorRect = RectI(left, bottom + screenSpaceRect.Height(), left + screenSpaceRect.Width(), bottom);
+	}
+
+	void RenderBase::RasterizeTriangle(Bitmap* target, const Texture* texture, const Vertex2& a, const Vertex2& b,
+									   const Vertex2& c)
+	{
+		float area = (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+		if (Math::Abs(area) < FLT_EPSILON)
+			return;
+
+		Vec2I size = target->GetSize();
+		int minX = Math::Max(Math::FloorToInt(Math::Min(a.x, Math::Min(b.x, c.x))), 0);
+		int maxX = Math::Min(Math::CeilToInt(Math::Max(a.x, Math::Max(b.x, c.x))), size.x - 1);
+		int minY = Math::Max(Math::FloorToInt(Math::Min(a.y, Math::Min(b.y, c.y))), 0);
+		int maxY = Math::Min(Math::CeilToInt(Math::Max(a.y, Math::Max(b.y, c.y))), size.y - 1);
+
+		if (mScissorTestEnabled)
+		{
+			minX = Math::Max(minX, mScreenScissorRect.left);
+			maxX = Math::Min(maxX, mScreenScissorRect.right - 1);
+			minY = Math::Max(minY, mScreenScissorRect.bottom);
+			maxY = Math::Min(maxY, mScreenScissorRect.top - 1);
+		}
+
+		Color4 ca, cb, cc;
+		ca.SetABGR(a.color);
+		cb.SetABGR(b.color);
+		cc.SetABGR(c.color);
+
+		float invArea = 1.0f/area;
+
+		for (int y = minY; y <= maxY; y++)
+		{
+			float py = y + 0.5f;
+
+			for (int x = minX; x <= maxX; x++)
+			{
+				float px = x + 0.5f;
+
+				// Barycentric coordinates, pixel on shared edge is filled by one triangle only
+				float wa = ((b.x - px)*(c.y - py) - (b.y - py)*(c.x - px))*invArea;
+				float wb = ((c.x - px)*(a.y - py) - (c.y - py)*(a.x - px))*invArea;
+				float wc = 1.0f - wa - wb;
+
+				if (wa < 0.0f || wb < 0.0f || wc <= 0.0f)
+					continue;
+
+				Color4 color((int)(ca.r*wa + cb.r*wb + cc.r*wc), (int)(ca.g*wa + cb.g*wb + cc.g*wc),
+							 (int)(ca.b*wa + cb.b*wb + cc.b*wc), (int)(ca.a*wa + cb.a*wb + cc.a*wc));
+
+				if (texture)
+					color = color*SampleTexture(texture, a.tu*wa + b.tu*wb + c.tu*wc, a.tv*wa + b.tv*wb + c.tv*wc);
+
+				BlendPixel(target, x, y, color);
+			}
+		}
+	}
+
+	void RenderBase::RasterizeLine(Bitmap* target, const Vertex2& a, const Vertex2& b)
+	{
+		Color4 ca, cb;
+		ca.SetABGR(a.color);
+		cb.SetABGR(b.color);
+
+		Vec2F delta(b.x - a.x, b.y - a.y);
+		int steps = Math::Max(Math::CeilToInt(Math::Max(Math::Abs(delta.x), Math::Abs(delta.y))), 1);
+
+		for (int i = 0; i <= steps; i++)
+		{
+			float coef = (float)i/(float)steps;
+			float invCoef = 1.0f - coef;
+
+			Color4 color((int)(ca.r*invCoef + cb.r*coef), (int)(ca.g*invCoef + cb.g*coef),
+						 (int)(ca.b*invCoef + cb.b*coef), (int)(ca.a*invCoef + cb.a*coef));
+
+			BlendPixel(target, Math::FloorToInt(a.x + delta.x*coef), Math::FloorToInt(a.y + delta.y*coef), color);
+		}
+	}
+
+	void RenderBase::BlendPixel(Bitmap* target, int x, int y, const Color4& color)
+	{
+		Vec2I size = target->GetSize();
+		if (x < 0 || y < 0 || x >= size.x || y >= size.y)
+			return;
+
+		if (mScissorTestEnabled && (x < mScreenScissorRect.left || x >= mScreenScissorRect.right ||
+									y < mScreenScissorRect.bottom || y >= mScreenScissorRect.top))
+		{
+			return;
+		}
+
+		// Same as GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA blending
+		UInt8* pixel = target->GetData() + (y*size.x + x)*4;
+		int srcAlpha = color.a, dstAlpha = 255 - color.a;
+
+		pixel[0] = (UInt8)((color.r*srcAlpha + pixel[0]*dstAlpha)/255);
+		pixel[1] = (UInt8)((color.g*srcAlpha + pixel[1]*dstAlpha)/255);
+		pixel[2] = (UInt8)((color.b*srcAlpha + pixel[2]*dstAlpha)/255);
+		pixel[3] = (UInt8)((color.a*srcAlpha + pixel[3]*dstAlpha)/255);
+	}
+
+	Color4 RenderBase::SampleTexture(const Texture* texture, float u, float v) const
+	{
+		const Bitmap* pixels = texture->mPixels;
+		if (!pixels)
+			return Color4::White();
+
+		// Nearest sampling with repeat wrapping
+		Vec2I size = pixels->GetSize();
+		int x = Math::FloorToInt((u - Math::Floor(u))*size.x)%size.x;
+		int y = Math::FloorToInt((v - Math::Floor(v))*size.y)%size.y;
+
+		const UInt8* pixel = pixels->getData() + (y*size.x + x)*4;
+		return Color4((int)pixel[0], (int)pixel[1], (int)pixel[2], (int)pixel[3]);
+	}
+}
+
+#endif // RENDER_HEADLESS
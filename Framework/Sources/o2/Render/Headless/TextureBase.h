@@ -0,0 +1,20 @@
+#pragma once
+
+#ifdef RENDER_HEADLESS
+
+namespace o2
+{
+	class Bitmap;
+
+	class TextureBase
+	{
+		friend class Render;
+		friend class RenderBase;
+		friend class VectorFont;
+
+	protected:
+		Bitmap* mPixels = nullptr; // Texture pixels in R8G8B8A8 format, rows are stored from bottom to top as in OpenGL
+	};
+}
+
+#endif // RENDER_HEADLESS
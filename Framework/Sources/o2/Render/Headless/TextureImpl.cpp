@@ -0,0 +1,143 @@
+#include "o2/stdafx.h"
+
+#ifdef RENDER_HEADLESS
+#include "o2/Render/Render.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+
+namespace o2
+{
+	// Copies pixels block between bitmaps, converts formats. Rows are copied as is, without flipping
+	static void CopyPixels(Bitmap* dst, const Vec2I& dstOffset, Bitmap* src, const Vec2I& srcOffset, const Vec2I& size)
+	{
+		int dstBpp = dst->GetFormat() == PixelFormat::R8G8B8A8 ? 4 : 3;
+		int srcBpp = src->GetFormat() == PixelFormat::R8G8B8A8 ? 4 : 3;
+
+		Vec2I dstSize = dst->GetSize(), srcSize = src->GetSize();
+		UInt8* dstData = dst->GetData();
+		UInt8* srcData = src->GetData();
+
+		for (int y = 0; y < size.y; y++)
+		{
+			int dy = dstOffset.y + y, sy = srcOffset.y + y;
+			if (dy < 0 || sy < 0 || dy >= dstSize.y || sy >= srcSize.y)
+				continue;
+
+			for (int x = 0; x < size.x; x++)
+			{
+				int dx = dstOffset.x + x, sx = srcOffset.x + x;
+				if (dx < 0 || sx < 0 || dx >= dstSize.x || sx >= srcSize.x)
+					continue;
+
+				UInt8* dstPixel = dstData + (dy*dstSize.x + dx)*dstBpp;
+				UInt8* srcPixel = srcData + (sy*srcSize.x + sx)*srcBpp;
+
+				dstPixel[0] = srcPixel[0];
+				dstPixel[1] = srcPixel[1];
+				dstPixel[2] = srcPixel[2];
+
+				if (dstBpp == 4)
+					dstPixel[3] = srcBpp == 4 ? srcPixel[3] : 255;
+			}
+		}
+	}
+
+	Texture::~Texture()
+	{
+		o2Render.mTextures.Remove(this);
+
+		delete mPixels;
+	}
+
+	void Texture::Create(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/)
+	{
+		delete mPixels;
+
+		mFormat = format;
+		mUsage = usage;
+		mSize = size;
+
+		mPixels = mnew Bitmap(PixelFormat::R8G8B8A8, size);
+		mPixels->Fill(Color4(0, 0, 0, 0));
+
+		mReady = true;
+	}
+
+	void Texture::Create(Bitmap* bitmap)
+	{
+		delete mPixels;
+
+		mFormat = bitmap->GetFormat();
+		mUsage = Usage::Default;
+		mSize = bitmap->GetSize();
+		mFileName = bitmap->GetFilename();
+
+		mPixels = mnew Bitmap(PixelFormat::R8G8B8A8, mSize);
+		CopyPixels(mPixels, Vec2I(), bitmap, Vec2I(), mSize);
+
+		mReady = true;
+	}
+
+	void Texture::SetData(Bitmap* bitmap)
+	{
+		o2Render.DrawPrimitives();
+
+		mSize = bitmap->GetSize();
+
+		delete mPixels;
+		mPixels = mnew Bitmap(PixelFormat::R8G8B8A8, mSize);
+		CopyPixels(mPixels, Vec2I(), bitmap, Vec2I(), mSize);
+	}
+
+	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
+	{
+		if (!mPixels)
+			return;
+
+		o2Render.DrawPrimitives();
+		CopyPixels(mPixels, offset, bitmap, Vec2I(), bitmap->GetSize());
+	}
+
+	void Texture::Copy(const Texture& from, const RectI& rect)
+	{
+		if (!from.mPixels)
+			return;
+
+		o2Render.DrawPrimitives();
+
+		Vec2I size(rect.Width(), rect.Height());
+		if (!mPixels || mSize != size)
+		{
+			delete mPixels;
+			mPixels = mnew Bitmap(PixelFormat::R8G8B8A8, size);
+			mSize = size;
+		}
+
+		CopyPixels(mPixels, Vec2I(), from.mPixels, Vec2I(rect.left, rect.top), size);
+	}
+
+	Bitmap* Texture::GetData()
+	{
+		o2Render.DrawPrimitives();
+
+		Bitmap* bitmap = mnew Bitmap(mFormat, mSize);
+
+		if (mPixels)
+			CopyPixels(bitmap, Vec2I(), mPixels, Vec2I(), mSize);
+
+		return bitmap;
+	}
+
+	void Texture::SetFilter(Filter filter)
+	{
+		o2Render.DrawPrimitives();
+		mFilter = filter;
+	}
+
+	Texture::Filter Texture::GetFilter() const
+	{
+		return mFilter;
+	}
+}
+
+#endif // RENDER_HEADLESS
@@ -0,0 +1,117 @@
+#include "o2/stdafx.h"
+#include "ParticlesBuffer.h"
+
+namespace o2
+{
+	int ParticlesBuffer::Count() const
+	{
+		return mCount;
+	}
+
+	int ParticlesBuffer::Capacity() const
+	{
+		return time.Count();
+	}
+
+	void ParticlesBuffer::Reserve(int capacity)
+	{
+		if (capacity <= Capacity())
+			return;
+
+		positionX.Resize(capacity);
+		positionY.Resize(capacity);
+		velocityX.Resize(capacity);
+		velocityY.Resize(capacity);
+		angle.Resize(capacity);
+		angleSpeed.Resize(capacity);
+		sizeX.Resize(capacity);
+		sizeY.Resize(capacity);
+		color.Resize(capacity);
+		time.Resize(capacity);
+	}
+
+	int ParticlesBuffer::Add()
+	{
+		if (mCount == Capacity())
+			Reserve(Math::Max(mCount*2, 16));
+
+		return mCount++;
+	}
+
+	int ParticlesBuffer::Add(const Particle& particle)
+	{
+		int idx = Add();
+		Set(idx, particle);
+		return idx;
+	}
+
+	void ParticlesBuffer::RemoveAt(int idx)
+	{
+		int last = --mCount;
+		if (idx == last)
+			return;
+
+		positionX[idx] = positionX[last];
+		positionY[idx] = positionY[last];
+		velocityX[idx] = velocityX[last];
+		velocityY[idx] = velocityY[last];
+		angle[idx] = angle[last];
+		angleSpeed[idx] = angleSpeed[last];
+		sizeX[idx] = sizeX[last];
+		sizeY[idx] = sizeY[last];
+		color[idx] = color[last];
+		time[idx] = time[last];
+	}
+
+	void ParticlesBuffer::Truncate(int count)
+	{
+		mCount = Math::Min(mCount, Math::Max(count, 0));
+	}
+
+	void ParticlesBuffer::Clear()
+	{
+		mCount = 0;
+	}
+
+	Particle ParticlesBuffer::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(positionX[idx], positionY[idx]);
+		res.velocity.Set(velocityX[idx], velocityY[idx]);
+		res.angle = angle[idx];
+		res.angleSpeed = angleSpeed[idx];
+		res.size.Set(sizeX[idx], sizeY[idx]);
+		res.color = color[idx];
+		res.time = time[idx];
+
+		return res;
+	}
+
+	void ParticlesBuffer::Set(int idx, const Particle& particle)
+	{
+		positionX[idx] = particle.position.x;
+		positionY[idx] = particle.position.y;
+		velocityX[idx] = particle.velocity.x;
+		velocityY[idx] = particle.velocity.y;
+		angle[idx] = particle.angle;
+		angleSpeed[idx] = particle.angleSpeed;
+		sizeX[idx] = particle.size.x;
+		sizeY[idx] = particle.size.y;
+		color[idx] = particle.color;
+		time[idx] = particle.time;
+	}
+
+	bool ParticlesBuffer::operator==(const ParticlesBuffer& other) const
+	{
+		if (mCount != other.mCount)
+			return false;
+
+		for (int i = 0; i < mCount; i++)
+		{
+			if (!(Get(i) == other.Get(i)))
+				return false;
+		}
+
+		return true;
+	}
+}
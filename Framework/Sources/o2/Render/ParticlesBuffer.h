@@ -0,0 +1,64 @@
+#pragma once
+
+#include "o2/Render/Particle.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Particles buffer. Stores particles as structure of arrays: each component is in separate array,
+	// so updates are processed by straight loops over continuous data. Alive particles are packed
+	// in [0, count) range, removed particle is replaced with the last one
+	// -----------------------------------------------------------------------------------------------
+	class ParticlesBuffer
+	{
+	public:
+		Vector<float>  positionX;  // Particles centers x positions
+		Vector<float>  positionY;  // Particles centers y positions
+		Vector<float>  velocityX;  // Particles x velocities
+		Vector<float>  velocityY;  // Particles y velocities
+		Vector<float>  angle;      // Particles angles in radians
+		Vector<float>  angleSpeed; // Particles angle speeds in radians/sec
+		Vector<float>  sizeX;      // Particles widths
+		Vector<float>  sizeY;      // Particles heights
+		Vector<Color4> color;      // Particles colors
+		Vector<float>  time;       // Particles estimate life times
+
+	public:
+		// Returns count of particles
+		int Count() const;
+
+		// Returns count of particles arrays can hold without reallocation
+		int Capacity() const;
+
+		// Resizes arrays to hold particles count without reallocation
+		void Reserve(int capacity);
+
+		// Adds particle at the end and returns it's index. Components values are not initialized
+		int Add();
+
+		// Adds particle at the end and returns it's index
+		int Add(const Particle& particle);
+
+		// Removes particle by index, last particle is moved to it's place
+		void RemoveAt(int idx);
+
+		// Removes particles from the end until count is greater than specified
+		void Truncate(int count);
+
+		// Removes all particles
+		void Clear();
+
+		// Returns particle by index
+		Particle Get(int idx) const;
+
+		// Sets particle by index
+		void Set(int idx, const Particle& particle);
+
+		// Check equals operator
+		bool operator==(const ParticlesBuffer& other) const;
+
+	protected:
+		int mCount = 0; // Count of particles
+	};
+}
@@ -6,21 +6,42 @@
 namespace o2
 {
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		UpdateParticles(dt, particles, 0, particles.Count());
+	}
+
+	void ParticlesEffect::UpdateParticles(float dt, ParticlesBuffer& particles, int begin, int end)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	ParticlesBuffer& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
 
-	void ParticlesGravityEffect::Update(float dt, ParticlesEmitter* emitter)
+	void ParticlesGravityEffect::UpdateParticles(float dt, ParticlesBuffer& particles, int begin, int end)
 	{
-		Vec2F v = gravity*dt;
-		for (auto& p : GetParticlesDirect(emitter))
-			p.velocity += v;
+		float vx = gravity.x*dt, vy = gravity.y*dt;
+		float* velocityX = particles.velocityX.Data();
+		float* velocityY = particles.velocityY.Data();
+
+		for (int i = begin; i < end; i++)
+		{
+			velocityX[i] += vx;
+			velocityY[i] += vy;
+		}
 	}
 }
 
 DECLARE_CLASS(o2::ParticlesEffect);
+CLASS_SERIALIZATION_META(o2::ParticlesEffect)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::ParticlesGravityEffect);
+CLASS_SERIALIZATION_META(o2::ParticlesGravityEffect)
+{
+	SERIALIZABLE_FIELD(gravity);
+}
+END_META;
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Serialization/Serializable.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesBuffer.h"
 
 namespace o2
 {
@@ -15,8 +15,15 @@ namespace o2
 		SERIALIZABLE(ParticlesEffect);
 
 	public:
+		// Updates effect for emitter's particles. Updates all particles with UpdateParticles by default.
+		// Can be called from worker thread, effect must change only emitter's particles
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+
+		// Updates particles in range [begin, end). Components are continuous arrays, process them by straight loops
+		virtual void UpdateParticles(float dt, ParticlesBuffer& particles, int begin, int end);
+
+		// Returns emitter's particles buffer
+		ParticlesBuffer& GetParticlesDirect(ParticlesEmitter* emitter);
 	};
 
 	class ParticlesGravityEffect : public ParticlesEffect
@@ -27,7 +34,8 @@ namespace o2
 		Vec2F gravity; // Vector of gravity @SERIALIZABLE
 
 	public:
-		void Update(float dt, ParticlesEmitter* emitter) override;
+		// Adds gravity to particles velocities
+		void UpdateParticles(float dt, ParticlesBuffer& particles, int begin, int end) override;
 	};
 }
 
@@ -44,7 +52,8 @@ CLASS_METHODS_META(o2::ParticlesEffect)
 {
 
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
-	PUBLIC_FUNCTION(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateParticles, float, ParticlesBuffer&, int, int);
+	PUBLIC_FUNCTION(ParticlesBuffer&, GetParticlesDirect, ParticlesEmitter*);
 }
 END_META;
 
@@ -61,6 +70,6 @@ END_META;
 CLASS_METHODS_META(o2::ParticlesGravityEffect)
 {
 
-	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateParticles, float, ParticlesBuffer&, int, int);
 }
 END_META;
@@ -10,14 +10,16 @@ namespace o2
 	ParticlesEmitter::ParticlesEmitter():
 		IRectDrawable()
 	{
+		ResetRandom();
 		mShape = mnew CircleParticlesEmitterShape();
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ReserveMeshes();
 		mLastTransform = mTransform;
 	}
 
 	ParticlesEmitter::~ParticlesEmitter()
 	{
-		delete mParticlesMesh;
+		for (auto mesh : mParticlesMeshes)
+			delete mesh;
 
 		for (auto effect : mEffects)
 			delete effect;
@@ -34,13 +36,14 @@ namespace o2
 		mEmitParticlesSpeed(other.mEmitParticlesSpeed), mEmitParticlesSpeedRangle(other.mEmitParticlesSpeedRangle),
 		mEmitParticlesMoveDirection(other.mEmitParticlesMoveDirection), mEmitParticlesMoveDirectionRange(other.mEmitParticlesMoveDirectionRange),
 		mEmitParticlesColorA(other.mEmitParticlesColorA), mEmitParticlesColorB(other.mEmitParticlesColorB),
-		playing(this), emittingCoefficient(this), particlesRelative(this), looped(this), maxParticles(this),
+		mRandomSeed(other.mRandomSeed), playing(this), emittingCoefficient(this), particlesRelative(this), looped(this), maxParticles(this),
 		duration(this), particlesLifetime(this), emitParticlesPerSecond(this), emitParticlesAngle(this), emitParticlesAngleRange(this),
 		emitParticlesSize(this), emitParticlesSizeRange(this), emitParticlesSpeed(this), emitParticlesAngleSpeedRange(this), emitParticlesAngleSpeed(this),
 		emitParticlesSpeedRange(this), emitParticlesMoveDir(this), emitParticlesMoveDirRange(this), emitParticlesColorA(this), emitParticlesColorB(this),
 		image(this), shape(this)
 	{
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ResetRandom();
+		ReserveMeshes();
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
@@ -53,18 +56,7 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
@@ -104,9 +96,16 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mRandomSeed = other.mRandomSeed;
+		ResetRandom();
+
+		for (auto mesh : mParticlesMeshes)
+		{
+			mesh->vertexCount = 0;
+			mesh->polyCount = 0;
+		}
+
+		ReserveMeshes();
 
 		mLastTransform = mTransform;
 
@@ -115,13 +114,23 @@ namespace o2
 
 	void ParticlesEmitter::Draw()
 	{
-		mParticlesMesh->Draw();
+		for (auto mesh : mParticlesMeshes)
+		{
+			if (mesh->polyCount > 0)
+				mesh->Draw();
+		}
 	}
 
 	void ParticlesEmitter::Update(float dt)
+	{
+		if (BeginUpdate(dt))
+			UpdateSimulation(dt);
+	}
+
+	bool ParticlesEmitter::BeginUpdate(float dt)
 	{
 		if (!mEnabled)
-			return;
+			return false;
 
 		if (mPlaying)
 		{
@@ -134,6 +143,27 @@ namespace o2
 			}
 		}
 
+		ReserveMeshes();
+
+		Vec2F invTexSize(1.0f, 1.0f);
+		TextureRef texture = mParticlesMeshes[0]->GetTexture();
+		if (texture)
+			invTexSize.Set(1.0f/texture->GetSize().x, 1.0f/texture->GetSize().y);
+
+		RectF textureSrcRect;
+		if (mImageAsset)
+			textureSrcRect = mImageAsset->GetAtlasRect();
+
+		mParticleUV.left = textureSrcRect.left*invTexSize.x;
+		mParticleUV.right = textureSrcRect.right*invTexSize.x;
+		mParticleUV.top = 1.0f - textureSrcRect.bottom*invTexSize.y;
+		mParticleUV.bottom = 1.0f - textureSrcRect.top*invTexSize.y;
+
+		return true;
+	}
+
+	void ParticlesEmitter::UpdateSimulation(float dt)
+	{
 		UpdateEmitting(dt);
 		UpdateEffects(dt);
 		UpdateParticles(dt);
@@ -160,36 +190,34 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.Count() < mParticlesNumLimit)
 			{
-				Particle* p;
+				int idx = mParticles.Add();
+
+				Vec2F position = Local2WorldPoint(mShape->GetEmittinPoint(mRandom));
+				mParticles.positionX[idx] = position.x;
+				mParticles.positionY[idx] = position.y;
 
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
+				mParticles.angle[idx] = mEmitParticlesAngle + mRandom.Range(-halfAngleRange, halfAngleRange);
 
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				mParticles.sizeX[idx] = mEmitParticlesSize.x + mRandom.Range(-halfSizeRange.x, halfSizeRange.x);
+				mParticles.sizeY[idx] = mEmitParticlesSize.y + mRandom.Range(-halfSizeRange.y, halfSizeRange.y);
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
+				Vec2F velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + mRandom.Range(-halfDirRange, halfDirRange))*
+					(mEmitParticlesSpeed + mRandom.Range(-halfSpeedRange, halfSpeedRange));
 
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
-					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
+				mParticles.velocityX[idx] = velocity.x;
+				mParticles.velocityY[idx] = velocity.y;
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				mParticles.angleSpeed[idx] = mEmitParticlesAngleSpeed + mRandom.Range(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				Color4& color = mParticles.color[idx];
+				color.r = mRandom.Range(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				color.g = mRandom.Range(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				color.b = mRandom.Range(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				color.a = mRandom.Range(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
 
-				mNumAliveParticles++;
+				mParticles.time[idx] = mParticlesLifetime;
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -207,80 +235,123 @@ namespace o2
 
 	void ParticlesEmitter::UpdateParticles(float dt)
 	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
+		int count = mParticles.Count();
 
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
+		float* positionX = mParticles.positionX.Data();
+		float* positionY = mParticles.positionY.Data();
+		const float* velocityX = mParticles.velocityX.Data();
+		const float* velocityY = mParticles.velocityY.Data();
+		float* angle = mParticles.angle.Data();
+		const float* angleSpeed = mParticles.angleSpeed.Data();
+		float* time = mParticles.time.Data();
 
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
+		// Branchless integration over continuous arrays, compiler vectorizes it
+		for (int i = 0; i < count; i++)
+		{
+			positionX[i] += velocityX[i]*dt;
+			positionY[i] += velocityY[i]*dt;
+			angle[i] += angleSpeed[i]*dt;
+			time[i] -= dt;
+		}
 
-			idx++;
+		// Remove dead particles, last particle takes place of removed one
+		for (int i = 0; i < mParticles.Count();)
+		{
+			if (time[i] < 0)
+				mParticles.RemoveAt(i);
+			else
+				i++;
 		}
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
-		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
-			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		float uvLeft = mParticleUV.left, uvRight = mParticleUV.right;
+		float uvUp = mParticleUV.top, uvDown = mParticleUV.bottom;
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
+		int count = mParticles.Count();
 
-		Vec2F invTexSize(1.0f, 1.0f);
-		if (mParticlesMesh->GetTexture())
+		if (mAnglesSin.Count() < count)
 		{
-			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
-						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
+			mAnglesSin.Resize(mParticles.Capacity());
+			mAnglesCos.Resize(mParticles.Capacity());
 		}
 
-		RectF textureSrcRect;
-		if (mImageAsset)
-			textureSrcRect = mImageAsset->GetAtlasRect();
+		const float* positionX = mParticles.positionX.Data();
+		const float* positionY = mParticles.positionY.Data();
+		const float* angle = mParticles.angle.Data();
+		const float* sizeX = mParticles.sizeX.Data();
+		const float* sizeY = mParticles.sizeY.Data();
+		const Color4* color = mParticles.color.Data();
+		float* anglesSin = mAnglesSin.Data();
+		float* anglesCos = mAnglesCos.Data();
+
+		// Trigonometry in separate straight loop, so it can be vectorized
+		for (int i = 0; i < count; i++)
+		{
+			anglesSin[i] = Math::Sin(angle[i]);
+			anglesCos[i] = Math::Cos(angle[i]);
+		}
+
+		// Indexes are filled once when meshes are reserved, only vertices are written here
+		for (int meshIdx = 0; meshIdx < mParticlesMeshes.Count(); meshIdx++)
+		{
+			Mesh* mesh = mParticlesMeshes[meshIdx];
+			int begin = meshIdx*mMaxMeshParticles;
+			int end = Math::Min(begin + mMaxMeshParticles, count);
+			int meshParticles = Math::Max(end - begin, 0);
+
+			Vertex2* vertex = mesh->vertices;
+			for (int i = begin; i < end; i++, vertex += 4)
+			{
+				float hx = sizeX[i]*0.5f, hy = sizeY[i]*0.5f;
+				float xvx = anglesCos[i]*hx, xvy = anglesSin[i]*hx;
+				float yvx = -anglesSin[i]*hy, yvy = anglesCos[i]*hy;
+				float ox = positionX[i], oy = positionY[i];
+				ULong colr = color[i].ARGB();
+
+				vertex[0].Set(ox - xvx + yvx, oy - xvy + yvy, colr, uvLeft, uvUp);
+				vertex[1].Set(ox + xvx + yvx, oy + xvy + yvy, colr, uvRight, uvUp);
+				vertex[2].Set(ox + xvx - yvx, oy + xvy - yvy, colr, uvRight, uvDown);
+				vertex[3].Set(ox - xvx - yvx, oy - xvy - yvy, colr, uvLeft, uvDown);
+			}
+
+			mesh->vertexCount = meshParticles*4;
+			mesh->polyCount = meshParticles*2;
+		}
+	}
 
-		float uvLeft = textureSrcRect.left*invTexSize.x;
-		float uvRight = textureSrcRect.right*invTexSize.x;
-		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
-		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
+	void ParticlesEmitter::ReserveMeshes()
+	{
+		int meshesCount = Math::Max((mParticlesNumLimit + mMaxMeshParticles - 1)/mMaxMeshParticles, 1);
+		TextureRef texture = mParticlesMeshes.IsEmpty() ? NoTexture() : mParticlesMeshes[0]->GetTexture();
 
-		for (auto& particle : mParticles)
+		for (int meshIdx = 0; meshIdx < meshesCount; meshIdx++)
 		{
-			if (!particle.alive)
+			int meshParticles = Math::Clamp(mParticlesNumLimit - meshIdx*mMaxMeshParticles, 1, mMaxMeshParticles);
+
+			if (meshIdx == mParticlesMeshes.Count())
+				mParticlesMeshes.Add(mnew Mesh(texture, 4, 2));
+
+			Mesh* mesh = mParticlesMeshes[meshIdx];
+			if (mesh->GetMaxVertexCount() >= (UInt)meshParticles*4)
 				continue;
 
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			mesh->Resize(meshParticles*4, meshParticles*2);
+			mesh->vertexCount = 0;
+			mesh->polyCount = 0;
+
+			UInt16* indexes = mesh->indexes;
+			for (int i = 0; i < meshParticles; i++, indexes += 6)
+			{
+				UInt16 vertex = (UInt16)(i*4);
+				indexes[0] = vertex;
+				indexes[1] = vertex + 1;
+				indexes[2] = vertex + 2;
+				indexes[3] = vertex;
+				indexes[4] = vertex + 2;
+				indexes[5] = vertex + 3;
+			}
 		}
 	}
 
@@ -290,8 +361,10 @@ namespace o2
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		float* positionX = mParticles.positionX.Data();
+		float* positionY = mParticles.positionY.Data();
+		for (int i = 0; i < mParticles.Count(); i++)
+			change.Transform(positionX[i], positionY[i]);
 
 		mLastTransform = mTransform;
 	}
@@ -330,10 +403,9 @@ namespace o2
 	{
 		mImageAsset = image;
 
-		if (mImageAsset)
-			mParticlesMesh->SetTexture(TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage()));
-		else
-			mParticlesMesh->SetTexture(NoTexture());
+		TextureRef texture = mImageAsset ? TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage()) : NoTexture();
+		for (auto mesh : mParticlesMeshes)
+			mesh->SetTexture(texture);
 	}
 
 	ImageAssetRef ParticlesEmitter::GetImage() const
@@ -381,19 +453,7 @@ namespace o2
 	void ParticlesEmitter::SetMaxParticles(int count)
 	{
 		mParticlesNumLimit = count;
-
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Truncate(mParticlesNumLimit);
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -403,15 +463,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.Count();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return mParticles.Count() > 0;
 	}
 
-	const Vector<Particle>& ParticlesEmitter::GetParticles() const
+	const ParticlesBuffer& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
@@ -597,6 +657,58 @@ namespace o2
 		mEmitParticlesColorA = colorA;
 		mEmitParticlesColorB = colorB;
 	}
+
+	void ParticlesEmitter::SetRandomSeed(UInt seed)
+	{
+		mRandomSeed = seed;
+		ResetRandom();
+	}
+
+	UInt ParticlesEmitter::GetRandomSeed() const
+	{
+		return mRandomSeed;
+	}
+
+	UInt ParticlesEmitter::GetDefaultRandomSeed() const
+	{
+		return 1;
+	}
+
+	void ParticlesEmitter::ResetRandom()
+	{
+		mRandom.SetSeed(mRandomSeed != 0 ? mRandomSeed : GetDefaultRandomSeed());
+	}
+
+	void ParticlesEmitter::OnDeserialized(const DataValue& node)
+	{
+		ResetRandom();
+	}
 }
 
 DECLARE_CLASS(o2::ParticlesEmitter);
+CLASS_SERIALIZATION_META(o2::ParticlesEmitter)
+{
+	SERIALIZABLE_FIELD(mImageAsset);
+	SERIALIZABLE_FIELD_DEFAULT(mShape, nullptr);
+	SERIALIZABLE_FIELD(mEffects);
+	SERIALIZABLE_FIELD_DEFAULT(mParticlesNumLimit, 100);
+	SERIALIZABLE_FIELD_DEFAULT(mPlaying, true);
+	SERIALIZABLE_FIELD_DEFAULT(mEmittingCoefficient, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mIsParticlesRelative, true);
+	SERIALIZABLE_FIELD_DEFAULT(mIsLooped, false);
+	SERIALIZABLE_FIELD_DEFAULT(mDuration, 1);
+	SERIALIZABLE_FIELD_DEFAULT(mParticlesLifetime, 0.5f);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesPerSecond, 10);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesAngle, 0);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesAngleRange, 45.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesSize, Vec2F(10, 10));
+	SERIALIZABLE_FIELD(mEmitParticlesSizeRange);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesSpeed, 10);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesSpeedRangle, 5);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesMoveDirection, 0);
+	SERIALIZABLE_FIELD_DEFAULT(mEmitParticlesMoveDirectionRange, 45.0f);
+	SERIALIZABLE_FIELD(mEmitParticlesColorA);
+	SERIALIZABLE_FIELD(mEmitParticlesColorB);
+	SERIALIZABLE_FIELD_DEFAULT(mRandomSeed, 0);
+}
+END_META;
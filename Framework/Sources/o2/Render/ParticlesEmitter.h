@@ -1,10 +1,12 @@
 #pragma once
 
 #include "o2/Assets/Types/ImageAsset.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesBuffer.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Utils/Math/Curve.h"
+#include "o2/Utils/Math/RandomGenerator.h"
+#include <climits>
 
 namespace o2
 {
@@ -124,8 +126,8 @@ namespace o2
 		// Returns has alive particles
 		bool IsAliveParticles() const;
 
-		// Returns particles list
-		const Vector<Particle>& GetParticles() const;
+		// Returns particles buffer
+		const ParticlesBuffer& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -235,6 +237,12 @@ namespace o2
 		// Sets emitting color A and B
 		void SetEmitParticlesColor(const Color4& colorA, const Color4& colorB);
 
+		// Sets random generator seed, restarts emitting random sequence. Zero seed means default emitter's seed
+		void SetRandomSeed(UInt seed);
+
+		// Returns random generator seed, zero when default emitter's seed is used
+		UInt GetRandomSeed() const;
+
 	protected:
 		ImageAssetRef          mImageAsset;      // Particle sprite image @SERIALIZABLE
 		ParticlesEmitterShape* mShape = nullptr; // Particles emitting shape @SERIALIZABLE @EDITOR_PROPERTY 
@@ -270,15 +278,29 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		UInt mRandomSeed = 0; // Emitting random sequence seed. When zero, default emitter's seed is used @SERIALIZABLE
+
+		static const int mMaxMeshParticles = USHRT_MAX/6; // Maximum particles in one mesh, limited by render buffers size: 6 indexes per particle
+
+		float           mCurrentTime = 0;    // Current working time in seconds
+		float           mEmitTimeBuffer = 0; // Emitting next particle time buffer
+		Vector<Mesh*>   mParticlesMeshes;    // Particles meshes, each one contains up to mMaxMeshParticles quads
+		ParticlesBuffer mParticles;          // Working particles
+		Vector<float>   mAnglesSin;          // Particles angles sinuses, mesh building buffer
+		Vector<float>   mAnglesCos;          // Particles angles cosinuses, mesh building buffer
+		RectF           mParticleUV;         // Particle quad texture coordinates, top is upper v and bottom is lower v
+		RandomGenerator mRandom;             // Own random generator, emitting doesn't depend on other emitters
+		Basis           mLastTransform;      // Last transformation
 
 	protected:
+		// Updates working time, reserves meshes and calculates texture coordinates. Returns false when emitter
+		// is disabled. Must be called from main thread
+		bool BeginUpdate(float dt);
+
+		// Emits and updates particles, builds mesh vertices. Doesn't touch shared resources, different emitters
+		// can be simulated in parallel after BeginUpdate
+		void UpdateSimulation(float dt);
+
 		// Emits particles hen updating
 		void UpdateEmitting(float dt);
 
@@ -290,10 +312,22 @@ namespace o2
 
 		// Updates mesh geometry
 		void UpdateMesh(); 
+
+		// Creates and resizes meshes to fit max particles count, fills quads indexes
+		void ReserveMeshes();
 		
 		// It is called when basis was changed, updates particles positions from last transform
 		void BasisChanged();
 
+		// Returns seed used when random seed isn't set
+		virtual UInt GetDefaultRandomSeed() const;
+
+		// Restarts random sequence from random seed
+		void ResetRandom();
+
+		// It is called when object was deserialized, restarts random sequence from loaded seed
+		void OnDeserialized(const DataValue& node) override;
+
 		friend class ParticlesEffect;
 	};
 
@@ -356,12 +390,15 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	PROTECTED_FIELD(mEmitParticlesAngleSpeedRange).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitParticlesColorA).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mEmitParticlesColorB).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mRandomSeed).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mCurrentTime).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitTimeBuffer).DEFAULT_VALUE(0);
-	PROTECTED_FIELD(mParticlesMesh).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mParticlesMeshes);
 	PROTECTED_FIELD(mParticles);
-	PROTECTED_FIELD(mDeadParticles);
-	PROTECTED_FIELD(mNumAliveParticles).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mAnglesSin);
+	PROTECTED_FIELD(mAnglesCos);
+	PROTECTED_FIELD(mParticleUV);
+	PROTECTED_FIELD(mRandom);
 	PROTECTED_FIELD(mLastTransform);
 }
 END_META;
@@ -388,7 +425,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(int, GetMaxParticles);
 	PUBLIC_FUNCTION(int, GetParticlesCount);
 	PUBLIC_FUNCTION(bool, IsAliveParticles);
-	PUBLIC_FUNCTION(const Vector<Particle>&, GetParticles);
+	PUBLIC_FUNCTION(const ParticlesBuffer&, GetParticles);
 	PUBLIC_FUNCTION(void, SetParticlesRelativity, bool);
 	PUBLIC_FUNCTION(bool, IsParticlesRelative);
 	PUBLIC_FUNCTION(void, SetLoop, bool);
@@ -425,10 +462,18 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(Color4, GetEmitParticlesColorB);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&, const Color4&);
+	PUBLIC_FUNCTION(void, SetRandomSeed, UInt);
+	PUBLIC_FUNCTION(UInt, GetRandomSeed);
+	PROTECTED_FUNCTION(bool, BeginUpdate, float);
+	PROTECTED_FUNCTION(void, UpdateSimulation, float);
 	PROTECTED_FUNCTION(void, UpdateEmitting, float);
 	PROTECTED_FUNCTION(void, UpdateEffects, float);
 	PROTECTED_FUNCTION(void, UpdateParticles, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(void, ReserveMeshes);
 	PROTECTED_FUNCTION(void, BasisChanged);
+	PROTECTED_FUNCTION(UInt, GetDefaultRandomSeed);
+	PROTECTED_FUNCTION(void, ResetRandom);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
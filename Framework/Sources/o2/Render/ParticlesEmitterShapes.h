@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Math/RandomGenerator.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -13,7 +14,8 @@ namespace o2
 
 	public:
 		virtual ~ParticlesEmitterShape() {}
-		virtual Vec2F GetEmittinPoint();
+		// Returns random emitting point, uses emitter's random generator
+		virtual Vec2F GetEmittinPoint(RandomGenerator& random);
 	};
 
 	// ---------------------------------
@@ -26,7 +28,7 @@ namespace o2
 	public:
 		float radius = 0;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(RandomGenerator& random) override;
 	};
 
 	// ---------------------------------
@@ -39,7 +41,7 @@ namespace o2
 	public:
 		Vec2F size;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(RandomGenerator& random) override;
 	};
 }
 
@@ -55,7 +57,7 @@ END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -72,7 +74,7 @@ END_META;
 CLASS_METHODS_META(o2::CircleParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -89,6 +91,6 @@ END_META;
 CLASS_METHODS_META(o2::SquareParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
@@ -77,3 +77,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::IRectDrawable);
+CLASS_SERIALIZATION_META(o2::IRectDrawable)
+{
+	SERIALIZABLE_FIELD(mColor);
+	SERIALIZABLE_FIELD(mEnabled);
+}
+END_META;
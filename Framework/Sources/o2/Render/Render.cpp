@@ -75,6 +75,37 @@ namespace o2
 		return mDIPCount;
 	}
 
+	int Render::GetDrawCallsCountBeforeReordering()
+	{
+		return mDeferredBatching ? mDIPCountBeforeReordering : mDIPCount;
+	}
+
+	void Render::SetDeferredBatching(bool enabled)
+	{
+		DrawPrimitives();
+		mDeferredBatching = enabled;
+	}
+
+	bool Render::IsDeferredBatching() const
+	{
+		return mDeferredBatching;
+	}
+
+	void Render::SetTexturesMemoryBudget(UInt64 bytes)
+	{
+		mTexturesMemoryBudget = bytes;
+	}
+
+	UInt64 Render::GetTexturesMemoryBudget() const
+	{
+		return mTexturesMemoryBudget;
+	}
+
+	const Render::TexturesCacheStats& Render::GetTexturesCacheStats() const
+	{
+		return mTexturesCacheStats;
+	}
+
 	void Render::SetCamera(const Camera& camera)
 	{
 		mCamera = camera;
@@ -148,10 +179,50 @@ namespace o2
 
 	void Render::CheckTexturesUnloading()
 	{
+		mTexturesCheckFrame++;
+
+		mTexturesCacheStats.usedBytes = 0;
+		mTexturesCacheStats.cachedBytes = 0;
+		mTexturesCacheStats.cachedCount = 0;
+
+		// Textures that can't be loaded again are unloaded immediately, others are kept in cache
 		Vector<Texture*> unloadTextures;
+		Vector<Texture*> cachedTextures;
 		for (auto texture : mTextures)
-			if (texture->mRefs == 0)
+		{
+			if (texture->mRefs > 0)
+			{
+				texture->mLastUsedFrame = mTexturesCheckFrame;
+				mTexturesCacheStats.usedBytes += texture->GetMemorySize();
+			}
+			else if (texture->mFileName.IsEmpty() || texture->mUsage != Texture::Usage::Default)
+				unloadTextures.Add(texture);
+			else
+			{
+				cachedTextures.Add(texture);
+				mTexturesCacheStats.cachedBytes += texture->GetMemorySize();
+				mTexturesCacheStats.cachedCount++;
+			}
+		}
+
+		if (mTexturesCacheStats.usedBytes + mTexturesCacheStats.cachedBytes > mTexturesMemoryBudget)
+		{
+			cachedTextures.SortBy<UInt64>([](Texture* texture) { return texture->mLastUsedFrame; });
+
+			for (auto texture : cachedTextures)
+			{
+				if (mTexturesCacheStats.usedBytes + mTexturesCacheStats.cachedBytes <= mTexturesMemoryBudget)
+					break;
+
+				UInt64 size = texture->GetMemorySize();
+				mTexturesCacheStats.cachedBytes -= size;
+				mTexturesCacheStats.cachedCount--;
+				mTexturesCacheStats.evictedBytes += size;
+				mTexturesCacheStats.evictedCount++;
+
 				unloadTextures.Add(texture);
+			}
+		}
 
 		unloadTextures.ForEach([](auto texture) { delete texture; });
 	}
@@ -557,6 +628,136 @@ namespace o2
 				   mesh->indexes, mesh->polyCount, mesh->mTexture);
 	}
 
+	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (!mReady)
+			return;
+
+		mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		if (mDeferredBatching && !mFlushingDeferredBuffers)
+			DeferBuffer(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+		else
+			SubmitBuffer(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+	}
+
+	void Render::DeferBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							 UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (verticesCount == 0)
+			return;
+
+		// Counting draw calls as they would be without reordering
+		if (mDeferredBuffers.IsEmpty() || mDeferredBuffers.Last().texture.mTexture != texture.mTexture ||
+			mDeferredBuffers.Last().primitiveType != primitiveType)
+		{
+			mDIPCountBeforeReordering++;
+		}
+
+		UInt indexesCount = primitiveType == PrimitiveType::Line ? elementsCount*2 : elementsCount*3;
+
+		DeferredBuffer buffer;
+		buffer.primitiveType = primitiveType;
+		buffer.texture = texture;
+		buffer.vertexOffset = mDeferredVertices.Count();
+		buffer.verticesCount = verticesCount;
+		buffer.indexOffset = mDeferredIndexes.Count();
+		buffer.elementsCount = elementsCount;
+
+		mDeferredVertices.Resize(buffer.vertexOffset + verticesCount);
+		memcpy(mDeferredVertices.Data() + buffer.vertexOffset, vertices, sizeof(Vertex2)*verticesCount);
+
+		mDeferredIndexes.Resize(buffer.indexOffset + indexesCount);
+		memcpy(mDeferredIndexes.Data() + buffer.indexOffset, indexes, sizeof(UInt16)*indexesCount);
+
+		buffer.bounds = RectF(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+		for (UInt i = 1; i < verticesCount; i++)
+		{
+			buffer.bounds.left = Math::Min(buffer.bounds.left, vertices[i].x);
+			buffer.bounds.right = Math::Max(buffer.bounds.right, vertices[i].x);
+			buffer.bounds.bottom = Math::Min(buffer.bounds.bottom, vertices[i].y);
+			buffer.bounds.top = Math::Max(buffer.bounds.top, vertices[i].y);
+		}
+
+		mDeferredBuffers.Add(buffer);
+	}
+
+	void Render::FlushDeferredBuffers()
+	{
+		if (mDeferredBuffers.IsEmpty() || mFlushingDeferredBuffers)
+			return;
+
+		mFlushingDeferredBuffers = true;
+
+		// Touching edges aren't overlapping, adjacent sprites can be reordered
+		auto isOverlapping = [](const RectF& a, const RectF& b) {
+			return a.left < b.right && b.left < a.right && a.bottom < b.top && b.bottom < a.top;
+		};
+
+		auto submit = [&](const DeferredBuffer& buffer) {
+			SubmitBuffer(buffer.primitiveType, mDeferredVertices.Data() + buffer.vertexOffset, buffer.verticesCount,
+						 mDeferredIndexes.Data() + buffer.indexOffset, buffer.elementsCount, buffer.texture);
+		};
+
+		int count = mDeferredBuffers.Count();
+
+		mDeferredBuffersSubmitted.Resize(count);
+		memset(mDeferredBuffersSubmitted.Data(), 0, count);
+
+		for (int i = 0; i < count; i++)
+		{
+			if (mDeferredBuffersSubmitted[i])
+				continue;
+
+			const DeferredBuffer& batchBuffer = mDeferredBuffers[i];
+			submit(batchBuffer);
+			mDeferredBuffersSubmitted[i] = 1;
+
+			// Pulls next buffers with same texture into batch, when they aren't overlapped by skipped buffers in between
+			mDeferredBuffersSkipped.Clear();
+
+			int lookaheadEnd = Math::Min(count, i + 1 + mDeferredBatchingLookahead);
+			for (int j = i + 1; j < lookaheadEnd; j++)
+			{
+				if (mDeferredBuffersSubmitted[j])
+					continue;
+
+				const DeferredBuffer& buffer = mDeferredBuffers[j];
+				if (buffer.texture.mTexture == batchBuffer.texture.mTexture && buffer.primitiveType == batchBuffer.primitiveType)
+				{
+					bool overlapped = false;
+					for (int skippedIdx : mDeferredBuffersSkipped)
+					{
+						if (isOverlapping(mDeferredBuffers[skippedIdx].bounds, buffer.bounds))
+						{
+							overlapped = true;
+							break;
+						}
+					}
+
+					if (!overlapped)
+					{
+						submit(buffer);
+						mDeferredBuffersSubmitted[j] = 1;
+						continue;
+					}
+				}
+
+				mDeferredBuffersSkipped.Add(j);
+			}
+		}
+
+		mDeferredBuffers.Clear();
+		mDeferredVertices.Clear();
+		mDeferredIndexes.Clear();
+
+		mFlushingDeferredBuffers = false;
+	}
+
 	void Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
 	{
 		auto dcolor = color.ABGR();
@@ -3,7 +3,9 @@
 #include "ft2build.h"
 #include FT_FREETYPE_H
 
-#if defined PLATFORM_WINDOWS
+#if defined RENDER_HEADLESS
+#include "o2/Render/Headless/RenderBase.h"
+#elif defined PLATFORM_WINDOWS
 #include "o2/Render/Windows/RenderBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/RenderBase.h"
@@ -60,6 +62,18 @@ namespace o2
 			bool operator==(const ScissorStackEntry& other) const;
 		};
 
+		// -------------------------
+		// Textures cache statistics
+		// -------------------------
+		struct TexturesCacheStats
+		{
+			UInt64 usedBytes = 0;    // Memory of referenced textures
+			UInt64 cachedBytes = 0;  // Memory of unreferenced textures kept in cache
+			int    cachedCount = 0;  // Count of unreferenced textures kept in cache
+			UInt64 evictedBytes = 0; // Summary memory of evicted textures
+			int    evictedCount = 0; // Count of evicted textures
+		};
+
 	public:
 		PROPERTIES(Render);
 		PROPERTY(Camera, camera, SetCamera, GetCamera);                          // Current camera property
@@ -101,6 +115,26 @@ namespace o2
 		// Returns draw calls count at last frame
 		int GetDrawCallsCount();
 
+		// Returns draw calls count at last frame as it would be without deferred batching reordering
+		int GetDrawCallsCountBeforeReordering();
+
+		// Sets deferred batching. When enabled, buffers are collected until render state changes, then not overlapping
+		// buffers are grouped by textures and submitted. It reduces draw calls when textures are interleaved
+		void SetDeferredBatching(bool enabled);
+
+		// Returns is deferred batching enabled
+		bool IsDeferredBatching() const;
+
+		// Sets textures memory budget in bytes. Unreferenced textures loaded from files stay in cache while textures
+		// memory fits budget, least recently used of them are unloaded first
+		void SetTexturesMemoryBudget(UInt64 bytes);
+
+		// Returns textures memory budget in bytes
+		UInt64 GetTexturesMemoryBudget() const;
+
+		// Returns textures cache statistics
+		const TexturesCacheStats& GetTexturesCacheStats() const;
+
 		// Binding camera. NULL - standard camera
 		void SetCamera(const Camera& camera);
 
@@ -239,7 +273,7 @@ namespace o2
 		// Draws mesh
 		void DrawMesh(Mesh* mesh);
 
-		// Draws data from buffer with specified texture and primitive type
+		// Draws data from buffer with specified texture and primitive type. Buffer is deferred when deferred batching is enabled
 		void DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
 						UInt16* indexes, UInt elementsCount, const TextureRef& texture);
 
@@ -274,6 +308,21 @@ namespace o2
 		// Returns scissor infos at current frame
 		const Vector<ScissorInfo>& GetScissorInfos() const;
 
+	protected:
+		// --------------------------------------------------------------
+		// Deferred buffer, collected by DrawBuffer with deferred batching
+		// --------------------------------------------------------------
+		struct DeferredBuffer
+		{
+			PrimitiveType primitiveType; // Type of primitives
+			TextureRef    texture;       // Buffer texture
+			UInt          vertexOffset;  // Offset in deferred vertices
+			UInt          verticesCount; // Count of vertices
+			UInt          indexOffset;   // Offset in deferred indexes
+			UInt          elementsCount; // Count of primitives
+			RectF         bounds;        // Vertices bounds, buffers can't be reordered when overlapping
+		};
+
 	protected:
 		PrimitiveType mCurrentPrimitiveType; // Type of drawing primitives for next DIP
 
@@ -283,12 +332,26 @@ namespace o2
 		UInt     mTrianglesCount;            // Triangles count for next DIP
 		UInt     mFrameTrianglesCount;       // Total triangles at current frame
 		UInt     mDIPCount;                  // DrawIndexedPrimitives calls count
+		UInt     mDIPCountBeforeReordering;  // DrawIndexedPrimitives calls count without deferred batching reordering
+
+		bool                   mDeferredBatching = false;         // Is deferred batching enabled
+		bool                   mFlushingDeferredBuffers = false;  // Is deferred buffers submitting now
+		int                    mDeferredBatchingLookahead = 128;  // Maximum count of next buffers checked for joining into batch
+		Vector<DeferredBuffer> mDeferredBuffers;                  // Deferred buffers in drawing order
+		Vector<Vertex2>        mDeferredVertices;                 // Deferred buffers vertices
+		Vector<UInt16>         mDeferredIndexes;                  // Deferred buffers indexes
+		Vector<UInt8>          mDeferredBuffersSubmitted;         // Submitted flags of deferred buffers, used when flushing
+		Vector<int>            mDeferredBuffersSkipped;           // Skipped buffers indices, used when flushing
 
 		LogStream* mLog; // Render log stream
 
 		Vector<Texture*> mTextures; // Loaded textures
 		Vector<Font*>    mFonts;    // Loaded fonts
 
+		UInt64             mTexturesMemoryBudget = 256*1024*1024; // Textures memory budget in bytes
+		TexturesCacheStats mTexturesCacheStats;                   // Textures cache statistics
+		UInt64             mTexturesCheckFrame = 0;               // Index of textures unloading check, used as LRU time
+
 		Camera mCamera;            // Camera transformation
 		Vec2I  mResolution;        // Primary back buffer size
 		Vec2I  mCurrentResolution; // Current back buffer size
@@ -345,6 +408,17 @@ namespace o2
 		// Send buffers to draw
 		void DrawPrimitives();
 
+		// Puts data into current batch, sends batch to draw when texture or primitive type changes
+		void SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+						  UInt16* indexes, UInt elementsCount, const TextureRef& texture);
+
+		// Copies buffer into deferred buffers
+		void DeferBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+						 UInt16* indexes, UInt elementsCount, const TextureRef& texture);
+
+		// Submits deferred buffers grouped by textures. Keeps drawing order of overlapping buffers
+		void FlushDeferredBuffers();
+
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
 
@@ -367,9 +441,11 @@ namespace o2
 		void OnAssetsRebuilded(const Vector<UID>& changedAssets);
 
 		friend class Application;
+		friend class Assets;
 		friend class BitmapFont;
 		friend class BitmapFontAsset;
 		friend class Font;
+		friend class RenderBase;
 		friend class Sprite;
 		friend class Texture;
 		friend class TextureRef;
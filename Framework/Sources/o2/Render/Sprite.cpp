@@ -1160,3 +1160,12 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Sprite);
+CLASS_SERIALIZATION_META(o2::Sprite)
+{
+	SERIALIZABLE_FIELD(mImageAsset);
+	SERIALIZABLE_FIELD_DEFAULT(mMode, SpriteMode::Default);
+	SERIALIZABLE_FIELD(mSlices);
+	SERIALIZABLE_FIELD_DEFAULT(mFill, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mTileScale, 1.0f);
+}
+END_META;
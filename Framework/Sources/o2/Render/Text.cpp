@@ -673,3 +673,16 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Text);
+CLASS_SERIALIZATION_META(o2::Text)
+{
+	SERIALIZABLE_FIELD(mText);
+	SERIALIZABLE_FIELD(mFontAssetId);
+	SERIALIZABLE_FIELD(mHeight);
+	SERIALIZABLE_FIELD(mSymbolsDistCoef);
+	SERIALIZABLE_FIELD(mLinesDistanceCoef);
+	SERIALIZABLE_FIELD(mVerAlign);
+	SERIALIZABLE_FIELD(mHorAlign);
+	SERIALIZABLE_FIELD(mWordWrap);
+	SERIALIZABLE_FIELD(mDotsEndings);
+}
+END_META;
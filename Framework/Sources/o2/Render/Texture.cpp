@@ -36,6 +36,13 @@ namespace o2
 		o2Render.mTextures.Add(this);
 	}
 
+	Texture::Texture(const String& fileName, Bitmap* bitmap) :
+		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
+	{
+		Create(fileName, bitmap);
+		o2Render.mTextures.Add(this);
+	}
+
 	Texture::Texture(UID atlasAssetId, int page) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
@@ -63,6 +70,13 @@ namespace o2
 		mReady = true;
 	}
 
+	void Texture::Create(const String& fileName, Bitmap* bitmap)
+	{
+		mFileName = fileName;
+		Create(bitmap);
+		mReady = true;
+	}
+
 	void Texture::Create(UID atlasAssetId, int page)
 	{
 		auto& info = o2Assets.GetAssetInfo(atlasAssetId);
@@ -99,6 +113,12 @@ namespace o2
 			Create(mFileName);
 	}
 
+	UInt64 Texture::GetMemorySize() const
+	{
+		int bpp = mFormat == PixelFormat::R8G8B8 ? 3 : 4;
+		return (UInt64)mSize.x*(UInt64)mSize.y*bpp;
+	}
+
 	Vec2I Texture::GetSize() const
 	{
 		return mSize;
@@ -1,6 +1,8 @@
 #pragma once
 
-#if defined PLATFORM_WINDOWS
+#if defined RENDER_HEADLESS
+#include "o2/Render/Headless/TextureBase.h"
+#elif defined PLATFORM_WINDOWS
 #include "o2/Render/Windows/TextureBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/TextureBase.h"
@@ -54,6 +56,9 @@ namespace o2
 		// Constructor from bitmap
 		Texture(Bitmap* bitmap);
 
+		// Constructor from bitmap already decoded from file. Used when file is decoded on worker thread
+		Texture(const String& fileName, Bitmap* bitmap);
+
 		// Destructor
 		~Texture();
 
@@ -72,6 +77,9 @@ namespace o2
 		// Creates texture from bitmap
 		void Create(Bitmap* bitmap);
 
+		// Creates texture from bitmap already decoded from file
+		void Create(const String& fileName, Bitmap* bitmap);
+
 		// Sets texture's data from bitmap
 		void SetData(Bitmap* bitmap);
 
@@ -117,6 +125,9 @@ namespace o2
 		// Returns atlas page
 		int GetAtlasPage() const;
 
+		// Returns texture memory size in bytes
+		UInt64 GetMemorySize() const;
+
 	protected:
 		Vec2I       mSize;                    // Size of texture
 		Filter      mFilter = Filter::Linear; // Min/Mag filter
@@ -129,6 +140,8 @@ namespace o2
 
 		int mRefs = 0; // Texture references
 
+		UInt64 mLastUsedFrame = 0; // Index of last render textures check when texture was referenced, used for unloading order
+
 		friend class Render;
 		friend class TextureRef;
 	};
@@ -335,3 +335,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::VectorFont::Effect);
+CLASS_SERIALIZATION_META(o2::VectorFont::Effect)
+{
+}
+END_META;
@@ -109,9 +109,37 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::FontStrokeEffect);
+CLASS_SERIALIZATION_META(o2::FontStrokeEffect)
+{
+	SERIALIZABLE_FIELD(radius);
+	SERIALIZABLE_FIELD(alphaThreshold);
+	SERIALIZABLE_FIELD(color);
+}
+END_META;
 
 DECLARE_CLASS(o2::FontGradientEffect);
+CLASS_SERIALIZATION_META(o2::FontGradientEffect)
+{
+	SERIALIZABLE_FIELD(color1);
+	SERIALIZABLE_FIELD(color2);
+	SERIALIZABLE_FIELD(angle);
+	SERIALIZABLE_FIELD(length);
+	SERIALIZABLE_FIELD(origin);
+}
+END_META;
 
 DECLARE_CLASS(o2::FontColorEffect);
+CLASS_SERIALIZATION_META(o2::FontColorEffect)
+{
+	SERIALIZABLE_FIELD(color);
+}
+END_META;
 
 DECLARE_CLASS(o2::FontShadowEffect);
+CLASS_SERIALIZATION_META(o2::FontShadowEffect)
+{
+	SERIALIZABLE_FIELD(blurRadius);
+	SERIALIZABLE_FIELD(offset);
+	SERIALIZABLE_FIELD(color);
+}
+END_META;
@@ -1,6 +1,6 @@
 #include "o2/stdafx.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined RENDER_HEADLESS
 #include "o2/Render/Render.h"
 
 #include "o2/Application/Application.h"
@@ -206,6 +206,7 @@ namespace o2
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mDIPCountBeforeReordering = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -224,6 +225,8 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		FlushDeferredBuffers();
+
 		if (mLastDrawVertex < 1)
 			return;
 
@@ -473,17 +476,9 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							  UInt16* indexes, UInt elementsCount, const TextureRef& texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount * 2;
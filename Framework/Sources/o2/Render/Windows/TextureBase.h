@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined RENDER_HEADLESS
 
 #include "o2/Render/Windows/OpenGL.h"
 
@@ -1,6 +1,6 @@
 #include "o2/stdafx.h"
 
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS && !defined RENDER_HEADLESS
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 
@@ -125,6 +125,8 @@ namespace o2
 
 	void Texture::SetData(Bitmap* bitmap)
 	{
+		o2Render.DrawPrimitives();
+
 		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
@@ -146,6 +148,8 @@ namespace o2
 
 	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
 	{
+		o2Render.DrawPrimitives();
+
 		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 
@@ -165,6 +169,8 @@ namespace o2
 
 	void Texture::Copy(const Texture& from, const RectI& rect)
 	{
+		o2Render.DrawPrimitives();
+
 		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
 		glBindTexture(GL_TEXTURE_2D, from.mHandle);
 
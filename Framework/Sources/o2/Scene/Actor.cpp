@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "Actor.h"
 
+#include "o2/Scene/ActorClonePlan.h"
 #include "o2/Scene/ActorDataValueConverter.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
@@ -50,13 +51,11 @@ namespace o2
 
 		SetPrototype(prototype);
 
-		Vector<Actor**> actorPointersFields;
-		Vector<Component**> componentPointersFields;
-		Map<const Actor*, Actor*> actorsMap;
-		Map<const Component*, Component*> componentsMap;
+		Vector<Actor*> actors;
+		Vector<Component*> components;
 
-		ProcessCopying(this, prototype->GetActor(), actorPointersFields, componentPointersFields, actorsMap, componentsMap, true);
-		FixComponentFieldsPointers(actorPointersFields, componentPointersFields, actorsMap, componentsMap);
+		ProcessCopying(this, prototype->GetActor(), actors, components, true);
+		prototype->GetClonePlan().FixPointers(actors, components);
 
 		transform->SetDirty();
 
@@ -91,13 +90,11 @@ namespace o2
 		if (other.mIsAsset)
 			SetPrototype(ActorAssetRef(other.GetAssetID()));
 
-		Vector<Actor**> actorPointersFields;
-		Vector<Component**> componentPointersFields;
-		Map<const Actor*, Actor*> actorsMap;
-		Map<const Component*, Component*> componentsMap;
+		Vector<Actor*> actors;
+		Vector<Component*> components;
 
-		ProcessCopying(this, &other, actorPointersFields, componentPointersFields, actorsMap, componentsMap, true);
-		FixComponentFieldsPointers(actorPointersFields, componentPointersFields, actorsMap, componentsMap);
+		ProcessCopying(this, &other, actors, components, true);
+		ActorClonePlan(&other).FixPointers(actors, components);
 
 		transform->SetDirty();
 
@@ -167,13 +164,11 @@ namespace o2
 
 		SetPrototype(other.mPrototype);
 
-		Vector<Actor**> actorPointersFields;
-		Vector<Component**> componentPointersFields;
-		Map<const Actor*, Actor*> actorsMap;
-		Map<const Component*, Component*> componentsMap;
+		Vector<Actor*> actors;
+		Vector<Component*> components;
 
-		ProcessCopying(this, &other, actorPointersFields, componentPointersFields, actorsMap, componentsMap, false);
-		FixComponentFieldsPointers(actorPointersFields, componentPointersFields, actorsMap, componentsMap);
+		ProcessCopying(this, &other, actors, components, false);
+		ActorClonePlan(&other).FixPointers(actors, components);
 
 		transform->SetDirty();
 
@@ -260,7 +255,11 @@ namespace o2
 
 	void Actor::SetID(SceneUID id)
 	{
+		SceneUID prevId = mId;
 		mId = id;
+
+		if (mSceneIndex >= 0 && prevId != mId)
+			o2Scene.OnActorIDChanged(this, prevId);
 	}
 
 	UID Actor::GetAssetID() const
@@ -278,7 +277,7 @@ namespace o2
 
 	void Actor::GenerateNewID(bool withChildren /*= true*/)
 	{
-		mId = Math::Random();
+		SetID(Math::Random());
 
 		if (withChildren)
 		{
@@ -921,7 +920,7 @@ namespace o2
 		if (ActorDataValueConverter::Instance().mLockDepth == 0)
 			ActorDataValueConverter::Instance().ActorCreated(this);
 
-		mId = node.GetMember("Id");
+		SetID(node.GetMember("Id"));
 		mName = node.GetMember("Name");
 
 		if (auto lockedNode = node.FindMember("Locked"))
@@ -1021,9 +1020,7 @@ namespace o2
 		mAssetId = otherActor.mAssetId;
 	}
 
-	void Actor::ProcessCopying(Actor* dest, const Actor* source, Vector<Actor**>& actorsPointers,
-							   Vector<Component**>& componentsPointers, Map<const Actor*, Actor*>& actorsMap,
-							   Map<const Component*, Component*>& componentsMap,
+	void Actor::ProcessCopying(Actor* dest, const Actor* source, Vector<Actor*>& actors, Vector<Component*>& components,
 							   bool isSourcePrototype)
 	{
 		if (!dest->mPrototype && source->mPrototype)
@@ -1046,7 +1043,7 @@ namespace o2
 				dest->mPrototypeLink = source->mPrototypeLink;
 		}
 
-		actorsMap.Add(source, dest);
+		actors.Add(dest);
 
 		for (auto child : source->mChildren)
 		{
@@ -1058,14 +1055,14 @@ namespace o2
 
 			dest->AddChild(newChild);
 
-			ProcessCopying(newChild, child, actorsPointers, componentsPointers, actorsMap, componentsMap, isSourcePrototype);
+			ProcessCopying(newChild, child, actors, components, isSourcePrototype);
 		}
 
 		for (auto component : source->mComponents)
 		{
 			Component* newComponent = dest->AddComponent(component->CloneAs<Component>());
 
-			componentsMap.Add(component, newComponent);
+			components.Add(newComponent);
 
 			if (dest->mPrototypeLink)
 			{
@@ -1074,8 +1071,6 @@ namespace o2
 				else
 					newComponent->mPrototypeLink = component->mPrototypeLink;
 			}
-
-			CollectFixingFields(newComponent, componentsPointers, actorsPointers);
 		}
 
 		dest->CopyData(*source);
@@ -1221,3 +1216,7 @@ ENUM_META(o2::Actor::SceneStatus)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::Actor);
+CLASS_SERIALIZATION_META(o2::Actor)
+{
+}
+END_META;
@@ -393,6 +393,13 @@ namespace o2
 
 		SceneStatus mSceneStatus = SceneStatus::NotInScene; // Actor on scene status
 
+		int mSceneIndex = -1; // Index in scene's all actors list, -1 when not registered
+		int mAddedIndex = -1; // Index in scene's added actors list, -1 when not waiting for adding
+		int mStartIndex = -1; // Index in scene's starting actors list, -1 when not waiting for start
+
+		UID mPoolId = UID(0);  // Scene's actors pool id, prototype asset id when actor is spawned from pool
+		int mPoolIndex = -1;   // Index in scene's actors pool, -1 when actor isn't despawned
+
 		bool mIsAsset = false; // Is this actor cached asset
 		UID  mAssetId;         // Source asset id
 
@@ -431,11 +438,8 @@ namespace o2
 		// Copies data of actor from other to this
 		virtual void CopyData(const Actor& otherActor);
 
-		// Processes copying actor
-		void ProcessCopying(Actor* dest, const Actor* source,
-							Vector<Actor**>& actorsPointers, Vector<Component**>& componentsPointers,
-							Map<const Actor*, Actor*>& actorsMap,
-							Map<const Component*, Component*>& componentsMap,
+		// Processes copying actor. Collects copied actors and components in order of ActorClonePlan
+		void ProcessCopying(Actor* dest, const Actor* source, Vector<Actor*>& actors, Vector<Component*>& components,
 							bool isSourcePrototype);
 
 		// Copies fields from source to dest
@@ -754,6 +758,11 @@ CLASS_FIELDS_META(o2::Actor)
 	PROTECTED_FIELD(mResEnabled).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mResEnabledInHierarchy).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mSceneStatus).DEFAULT_VALUE(SceneStatus::NotInScene);
+	PROTECTED_FIELD(mSceneIndex).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mAddedIndex).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mStartIndex).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mPoolId).DEFAULT_VALUE(UID(0));
+	PROTECTED_FIELD(mPoolIndex).DEFAULT_VALUE(-1);
 	PROTECTED_FIELD(mIsAsset).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mAssetId);
 	PROTECTED_FIELD(mReferences);
@@ -766,16 +775,14 @@ END_META;
 CLASS_METHODS_META(o2::Actor)
 {
 
-	typedef Map<const Actor*, Actor*>& _tmp1;
-	typedef Map<const Component*, Component*>& _tmp2;
-	typedef const Map<const Actor*, Actor*>& _tmp3;
-	typedef const Map<const Component*, Component*>& _tmp4;
-	typedef Map<String, Actor*> _tmp5;
-	typedef Map<String, Component*> _tmp6;
+	typedef const Map<const Actor*, Actor*>& _tmp1;
+	typedef const Map<const Component*, Component*>& _tmp2;
+	typedef Map<String, Actor*> _tmp3;
+	typedef Map<String, Component*> _tmp4;
+	typedef Map<const Actor*, Actor*>& _tmp5;
+	typedef Map<const Component*, Component*>& _tmp6;
 	typedef Map<const Actor*, Actor*>& _tmp7;
 	typedef Map<const Component*, Component*>& _tmp8;
-	typedef Map<const Actor*, Actor*>& _tmp9;
-	typedef Map<const Component*, Component*>& _tmp10;
 
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
@@ -861,19 +868,19 @@ CLASS_METHODS_META(o2::Actor)
 	PUBLIC_FUNCTION(void, OnNameChanged);
 	PUBLIC_FUNCTION(void, OnChildrenChanged);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
-	PROTECTED_FUNCTION(void, ProcessCopying, Actor*, const Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp1, _tmp2, bool);
+	PROTECTED_FUNCTION(void, ProcessCopying, Actor*, const Actor*, Vector<Actor*>&, Vector<Component*>&, bool);
 	PROTECTED_FUNCTION(void, CopyFields, Vector<const FieldInfo*>&, IObject*, IObject*, Vector<Actor**>&, Vector<Component**>&, Vector<ISerializable*>&);
 	PROTECTED_FUNCTION(void, CollectFixingFields, Component*, Vector<Component**>&, Vector<Actor**>&);
 	PROTECTED_FUNCTION(void, GetComponentFields, Component*, Vector<const FieldInfo*>&);
-	PROTECTED_FUNCTION(void, FixComponentFieldsPointers, const Vector<Actor**>&, const Vector<Component**>&, _tmp3, _tmp4);
+	PROTECTED_FUNCTION(void, FixComponentFieldsPointers, const Vector<Actor**>&, const Vector<Component**>&, _tmp1, _tmp2);
 	PROTECTED_FUNCTION(void, UpdateResEnabled);
 	PROTECTED_FUNCTION(void, UpdateResEnabledInHierarchy);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, SerializeRaw, DataValue&);
 	PROTECTED_FUNCTION(void, DeserializeRaw, const DataValue&);
-	PROTECTED_FUNCTION(_tmp5, GetAllChilds);
-	PROTECTED_FUNCTION(_tmp6, GetAllComponents);
+	PROTECTED_FUNCTION(_tmp3, GetAllChilds);
+	PROTECTED_FUNCTION(_tmp4, GetAllComponents);
 	PROTECTED_FUNCTION(void, GetAllChildrenActors, Vector<Actor*>&);
 	PROTECTED_FUNCTION(void, SetParentProp, Actor*);
 	PROTECTED_FUNCTION(void, OnAddToScene);
@@ -894,11 +901,11 @@ CLASS_METHODS_META(o2::Actor)
 	PROTECTED_FUNCTION(void, OnComponentRemoving, Component*);
 	PROTECTED_FUNCTION(void, SerializeWithProto, DataValue&);
 	PROTECTED_FUNCTION(void, DeserializeWithProto, const DataValue&);
-	PROTECTED_FUNCTION(void, ProcessPrototypeMaking, Actor*, Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp7, _tmp8, bool);
+	PROTECTED_FUNCTION(void, ProcessPrototypeMaking, Actor*, Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp5, _tmp6, bool);
 	PROTECTED_FUNCTION(void, CopyChangedFields, Vector<const FieldInfo*>&, IObject*, IObject*, IObject*, Vector<Actor**>&, Vector<Component**>&, Vector<ISerializable*>&);
 	PROTECTED_FUNCTION(void, CopyActorChangedFields, Actor*, Actor*, Actor*, Vector<Actor*>&, bool);
 	PROTECTED_FUNCTION(void, SeparateActors, Vector<Actor*>&);
-	PROTECTED_FUNCTION(void, ProcessReverting, Actor*, const Actor*, const Vector<Actor*>&, Vector<Actor**>&, Vector<Component**>&, _tmp9, _tmp10, Vector<ISerializable*>&);
+	PROTECTED_FUNCTION(void, ProcessReverting, Actor*, const Actor*, const Vector<Actor*>&, Vector<Actor**>&, Vector<Component**>&, _tmp7, _tmp8, Vector<ISerializable*>&);
 	PROTECTED_FUNCTION(void, SetProtytypeDummy, ActorAssetRef);
 	PROTECTED_FUNCTION(void, SetPrototype, ActorAssetRef);
 	PROTECTED_FUNCTION(void, UpdateLocking);
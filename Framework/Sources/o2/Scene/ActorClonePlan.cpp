@@ -0,0 +1,198 @@
+#include "o2/stdafx.h"
+#include "ActorClonePlan.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Component.h"
+
+namespace o2
+{
+	ActorClonePlan::ActorClonePlan()
+	{}
+
+	ActorClonePlan::ActorClonePlan(const Actor* source)
+	{
+		Build(source);
+	}
+
+	void ActorClonePlan::Build(const Actor* source)
+	{
+		Clear();
+
+		CollectSources(source);
+
+		Map<const void*, int> actorsIndices;
+		for (int i = 0; i < mSourceActors.Count(); i++)
+			actorsIndices.Add(mSourceActors[i], i);
+
+		Map<const void*, int> componentsIndices;
+		for (int i = 0; i < mSourceComponents.Count(); i++)
+			componentsIndices.Add(mSourceComponents[i], i);
+
+		// Pointers fields offsets are same for all components of type
+		Map<const Type*, Vector<FieldOffset>> typesFields;
+
+		for (int i = 0; i < mSourceComponents.Count(); i++)
+		{
+			const Component* component = mSourceComponents[i];
+			const Type* type = mSourceComponentTypes[i];
+
+			Vector<FieldOffset>* fields;
+			auto fnd = typesFields.find(type);
+			if (fnd != typesFields.end())
+				fields = &fnd->second;
+			else
+			{
+				fields = &typesFields[type];
+				CollectPointerFields(component, *fields);
+			}
+
+			for (auto& field : *fields)
+			{
+				const void* value = *(const void**)((const char*)component + field.offset);
+
+				int targetIdx = -1;
+				if (value)
+				{
+					if (field.isActor)
+						actorsIndices.TryGetValue(value, targetIdx);
+					else
+						componentsIndices.TryGetValue(value, targetIdx);
+				}
+
+				mPointerFields.Add(PointerField{ i, field.offset, field.isActor, targetIdx, value });
+			}
+		}
+
+		mBuilt = true;
+	}
+
+	void ActorClonePlan::Clear()
+	{
+		mSourceActors.Clear();
+		mSourceComponents.Clear();
+		mSourceComponentTypes.Clear();
+		mPointerFields.Clear();
+
+		mBuilt = false;
+	}
+
+	bool ActorClonePlan::IsBuilt() const
+	{
+		return mBuilt;
+	}
+
+	bool ActorClonePlan::IsMatching(const Actor* source) const
+	{
+		if (!mBuilt)
+			return false;
+
+		int actorIdx = 0, componentIdx = 0;
+		if (!IsMatching(source, actorIdx, componentIdx))
+			return false;
+
+		return actorIdx == mSourceActors.Count() && componentIdx == mSourceComponents.Count();
+	}
+
+	void ActorClonePlan::FixPointers(const Vector<Actor*>& actors, const Vector<Component*>& components) const
+	{
+		for (auto& field : mPointerFields)
+		{
+			void** valuePtr = (void**)((char*)components[field.componentIdx] + field.offset);
+
+			// Value can differ from source when component's copying changes it, search target in this case
+			int targetIdx = field.targetIdx;
+			if (*valuePtr != field.sourceValue)
+			{
+				if (field.isActor)
+					targetIdx = mSourceActors.IndexOf((const Actor*)*valuePtr);
+				else
+					targetIdx = mSourceComponents.IndexOf((const Component*)*valuePtr);
+			}
+
+			if (targetIdx < 0)
+				continue;
+
+			if (field.isActor)
+				*valuePtr = actors[targetIdx];
+			else
+				*valuePtr = components[targetIdx];
+		}
+	}
+
+	bool ActorClonePlan::IsRedirectedPointerType(const Type* type)
+	{
+		if (type->GetUsage() != Type::Usage::Pointer)
+			return false;
+
+		const PointerType* pointerType = (const PointerType*)type;
+		return *pointerType == TypeOf(Actor*) || pointerType->GetUnpointedType()->IsBasedOn(TypeOf(Component));
+	}
+
+	void ActorClonePlan::CollectSources(const Actor* actor)
+	{
+		mSourceActors.Add(actor);
+
+		for (auto child : actor->GetChildren())
+			CollectSources(child);
+
+		for (auto component : actor->GetComponents())
+		{
+			mSourceComponents.Add(component);
+			mSourceComponentTypes.Add(&component->GetType());
+		}
+	}
+
+	void ActorClonePlan::CollectPointerFields(const Component* component, Vector<FieldOffset>& fields)
+	{
+		struct helper
+		{
+			static void Collect(const Type* type, const Component* component, Vector<FieldOffset>& fields)
+			{
+				for (auto& field : type->GetFields())
+				{
+					if (!IsRedirectedPointerType(field.GetType()))
+						continue;
+
+					bool isActor = *field.GetType() == TypeOf(Actor*);
+					int offset = (int)((const char*)field.GetValuePtrStrong(component) - (const char*)component);
+					fields.Add(FieldOffset{ offset, isActor });
+				}
+
+				for (auto baseType : type->GetBaseTypes())
+				{
+					if (*baseType.type != TypeOf(Component))
+						Collect(baseType.type, component, fields);
+				}
+			}
+		};
+
+		helper::Collect(&component->GetType(), component, fields);
+	}
+
+	bool ActorClonePlan::IsMatching(const Actor* actor, int& actorIdx, int& componentIdx) const
+	{
+		if (actorIdx >= mSourceActors.Count() || mSourceActors[actorIdx] != actor)
+			return false;
+
+		actorIdx++;
+
+		for (auto child : actor->GetChildren())
+		{
+			if (!IsMatching(child, actorIdx, componentIdx))
+				return false;
+		}
+
+		for (auto component : actor->GetComponents())
+		{
+			if (componentIdx >= mSourceComponents.Count() || mSourceComponents[componentIdx] != component ||
+				mSourceComponentTypes[componentIdx] != &component->GetType())
+			{
+				return false;
+			}
+
+			componentIdx++;
+		}
+
+		return true;
+	}
+}
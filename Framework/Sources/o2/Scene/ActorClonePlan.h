@@ -0,0 +1,76 @@
+#pragma once
+
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class Component;
+	class Type;
+
+	// -----------------------------------------------------------------------------------------------
+	// Actor clone plan. Flattened description of actors hierarchy copying: source actors and components
+	// in copying order and component's pointer fields offsets with their targets indices. Built once
+	// and replayed on each copying instead of reflection fields search and pointers maps filling
+	// -----------------------------------------------------------------------------------------------
+	class ActorClonePlan
+	{
+	public:
+		// Default constructor, empty plan
+		ActorClonePlan();
+
+		// Constructor, builds plan for source hierarchy
+		ActorClonePlan(const Actor* source);
+
+		// Builds plan for source actors hierarchy
+		void Build(const Actor* source);
+
+		// Resets plan
+		void Clear();
+
+		// Returns is plan built
+		bool IsBuilt() const;
+
+		// Checks that plan is built for source hierarchy: same actors and components in same order
+		bool IsMatching(const Actor* source) const;
+
+		// Redirects copied components pointer fields to copies. Actors and components must be in plan's order
+		void FixPointers(const Vector<Actor*>& actors, const Vector<Component*>& components) const;
+
+		// Returns is type actor or component pointer. Component's fields of such types are redirected to copies
+		static bool IsRedirectedPointerType(const Type* type);
+
+	protected:
+		struct PointerField
+		{
+			int         componentIdx; // Owner component index
+			int         offset;       // Field offset from component pointer
+			bool        isActor;      // Is pointer to actor, otherwise to component
+			int         targetIdx;    // Pointed actor or component index in plan, -1 when points outside
+			const void* sourceValue;  // Pointer value in source component
+		};
+
+		struct FieldOffset
+		{
+			int  offset;  // Field offset from component pointer
+			bool isActor; // Is pointer to actor, otherwise to component
+		};
+
+		Vector<const Actor*>     mSourceActors;         // Source actors in copying order
+		Vector<const Component*> mSourceComponents;     // Source components in copying order
+		Vector<const Type*>      mSourceComponentTypes; // Source components types, checked when matching
+		Vector<PointerField>     mPointerFields;        // Components pointers fields
+
+		bool mBuilt = false; // Is plan built
+
+	protected:
+		// Collects actors and components in copying order
+		void CollectSources(const Actor* actor);
+
+		// Collects actors and components pointers fields offsets of component's type
+		static void CollectPointerFields(const Component* component, Vector<FieldOffset>& fields);
+
+		// Checks actors and components matching recursively
+		bool IsMatching(const Actor* actor, int& actorIdx, int& componentIdx) const;
+	};
+}
@@ -125,7 +125,7 @@ namespace o2
 			}
 		}
 
-		mId = node.GetMember("Id");
+		SetID(node.GetMember("Id"));
 
 		if (!mPrototypeLink)
 			return;
@@ -432,6 +432,10 @@ namespace o2
 		// Returns parent rectange, or zero when no parent
 		virtual RectF GetParentRectangle() const;
 
+		// Returns is transform updated by scene transforms pass. Transforms with own update logic return false and
+		// are updated by owner actor
+		virtual bool IsUpdatedByScene() const;
+
 		// Updates world rectangle and transform relative to parent or origin
 		void UpdateWorldRectangleAndTransform();
 
@@ -453,7 +457,17 @@ namespace o2
 		// Returns parent world rect position - left bottom corner
 		Vec2F GetParentPosition() const;
 
+		// Calculates local rectangle from position, size and pivot
+		static void CalculateRectangle(ActorTransformData& data);
+
+		// Calculates local transformation
+		static void CalculateTransform(ActorTransformData& data);
+
+		// Calculates world rectangle and transform from parent data. Parent data is null for root
+		static void CalculateWorldRectangleAndTransform(ActorTransformData& data, const ActorTransformData* parentData);
+
 		friend class Actor;
+		friend class Scene;
 		friend class WidgetLayout;
 	};
 
@@ -487,6 +501,8 @@ namespace o2
 
 		Actor* owner = nullptr; // Owner actor 
 
+		int sceneDirtyIndex = -1; // Index in scene dirty transforms list, -1 when not listed
+
 		SERIALIZABLE(ActorTransformData);
 	};
 }
@@ -661,6 +677,7 @@ CLASS_METHODS_META(o2::ActorTransform)
 	PROTECTED_FUNCTION(void, CopyFrom, const ActorTransform&);
 	PROTECTED_FUNCTION(void, SetOwner, Actor*);
 	PROTECTED_FUNCTION(RectF, GetParentRectangle);
+	PROTECTED_FUNCTION(bool, IsUpdatedByScene);
 	PROTECTED_FUNCTION(void, UpdateWorldRectangleAndTransform);
 	PROTECTED_FUNCTION(void, UpdateTransform);
 	PROTECTED_FUNCTION(void, UpdateRectangle);
@@ -668,6 +685,9 @@ CLASS_METHODS_META(o2::ActorTransform)
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(Vec2F, GetParentPosition);
+	PROTECTED_STATIC_FUNCTION(void, CalculateRectangle, ActorTransformData&);
+	PROTECTED_STATIC_FUNCTION(void, CalculateTransform, ActorTransformData&);
+	PROTECTED_STATIC_FUNCTION(void, CalculateWorldRectangleAndTransform, ActorTransformData&, const ActorTransformData*);
 }
 END_META;
 
@@ -698,6 +718,7 @@ CLASS_FIELDS_META(o2::ActorTransformData)
 	PUBLIC_FIELD(parentTransform);
 	PUBLIC_FIELD(parentInvTransformActualFrame);
 	PUBLIC_FIELD(owner).DEFAULT_VALUE(nullptr);
+	PUBLIC_FIELD(sceneDirtyIndex).DEFAULT_VALUE(-1);
 }
 END_META;
 CLASS_METHODS_META(o2::ActorTransformData)
@@ -10,7 +10,8 @@ namespace o2
 	{}
 
 	CameraActor::CameraActor(const CameraActor& other):
-		Actor(other), mType(other.mType), mFixedOrFittedSize(other.mFixedOrFittedSize), mUnits(other.mUnits)
+		Actor(other), cullDrawables(other.cullDrawables), mType(other.mType), mFixedOrFittedSize(other.mFixedOrFittedSize), 
+		mUnits(other.mUnits)
 	{}
 
 	CameraActor::~CameraActor()
@@ -22,6 +23,7 @@ namespace o2
 	{
 		Actor::operator=(other);
 
+		cullDrawables = other.cullDrawables;
 		mType = other.mType;
 		mFixedOrFittedSize = other.mFixedOrFittedSize;
 		mUnits = other.mUnits;
@@ -40,11 +42,31 @@ namespace o2
 			o2Render.Clear(fillColor);
 
 		Camera prevCamera = o2Render.GetCamera();
-		Setup();
+		Camera camera = GetRenderCamera();
+		o2Render.SetCamera(camera);
+
+		mVisitedDrawablesCount = 0;
+		mCulledDrawablesCount = 0;
+
+		RectF cameraRect = camera.GetAxisAlignedRect();
 
 		for (auto layer : drawLayers.GetLayers())
 		{
-			for (auto comp : layer->mEnabledDrawables)
+			if (!cullDrawables)
+			{
+				mVisitedDrawablesCount += layer->mEnabledDrawables.Count();
+
+				for (auto comp : layer->mEnabledDrawables)
+					comp->Draw();
+
+				continue;
+			}
+
+			mVisibleDrawables.Clear();
+			mVisitedDrawablesCount += layer->GetVisibleDrawables(cameraRect, mVisibleDrawables);
+			mCulledDrawablesCount += layer->mEnabledDrawables.Count() - mVisibleDrawables.Count();
+
+			for (auto comp : mVisibleDrawables)
 				comp->Draw();
 		}
 
@@ -111,6 +133,16 @@ namespace o2
 		return mUnits;
 	}
 
+	int CameraActor::GetVisitedDrawablesCount() const
+	{
+		return mVisitedDrawablesCount;
+	}
+
+	int CameraActor::GetCulledDrawablesCount() const
+	{
+		return mCulledDrawablesCount;
+	}
+
 	void CameraActor::OnAddToScene()
 	{
 		o2Scene.OnCameraAddedOnScene(this);
@@ -138,3 +170,14 @@ ENUM_META(o2::CameraActor::Type)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::CameraActor);
+CLASS_SERIALIZATION_META(o2::CameraActor)
+{
+	SERIALIZABLE_FIELD(drawLayers);
+	SERIALIZABLE_FIELD_DEFAULT(fillBackground, true);
+	SERIALIZABLE_FIELD_DEFAULT(fillColor, Color4::White());
+	SERIALIZABLE_FIELD_DEFAULT(cullDrawables, true);
+	SERIALIZABLE_FIELD_DEFAULT(mType, Type::Default);
+	SERIALIZABLE_FIELD(mFixedOrFittedSize);
+	SERIALIZABLE_FIELD_DEFAULT(mUnits, Units::Centimeters);
+}
+END_META;
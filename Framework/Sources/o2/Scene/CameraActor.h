@@ -18,6 +18,8 @@ namespace o2
 		bool   fillBackground = true;       // Is background filling with solid color @SERIALIZABLE
 		Color4 fillColor = Color4::White(); // Background fill color @SERIALIZABLE
 
+		bool cullDrawables = true; // Is drawables outside camera rectangle skipped when drawing @SERIALIZABLE
+
 	public:
 		// Default constructor
 		CameraActor();
@@ -61,6 +63,12 @@ namespace o2
 		// Returns current camera units
 		Units GetUnits() const;
 
+		// Returns count of drawables visited by culling at last drawing
+		int GetVisitedDrawablesCount() const;
+
+		// Returns count of enabled drawables skipped by culling at last drawing
+		int GetCulledDrawablesCount() const;
+
 		SERIALIZABLE(CameraActor);
 
 	protected:
@@ -68,6 +76,10 @@ namespace o2
 		Vec2F mFixedOrFittedSize;          // Fitted or fixed types size @SERIALIZABLE
 		Units mUnits = Units::Centimeters; // Physical camera units @SERIALIZABLE
 
+		Vector<ISceneDrawable*> mVisibleDrawables;           // Visible drawables buffer, used at drawing
+		int                     mVisitedDrawablesCount = 0; // Count of drawables visited by culling at last drawing
+		int                     mCulledDrawablesCount = 0;  // Count of enabled drawables skipped by culling at last drawing
+
 	protected:
 		// Is is called when actor has added to scene
 		void OnAddToScene() override;
@@ -89,9 +101,13 @@ CLASS_FIELDS_META(o2::CameraActor)
 	PUBLIC_FIELD(drawLayers).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(fillBackground).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(fillColor).DEFAULT_VALUE(Color4::White()).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(cullDrawables).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mType).DEFAULT_VALUE(Type::Default).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mFixedOrFittedSize).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mUnits).DEFAULT_VALUE(Units::Centimeters).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mVisibleDrawables);
+	PROTECTED_FIELD(mVisitedDrawablesCount).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mCulledDrawablesCount).DEFAULT_VALUE(0);
 }
 END_META;
 CLASS_METHODS_META(o2::CameraActor)
@@ -107,6 +123,8 @@ CLASS_METHODS_META(o2::CameraActor)
 	PUBLIC_FUNCTION(Type, GetCameraType);
 	PUBLIC_FUNCTION(const Vec2F&, GetFittedOrFixedSize);
 	PUBLIC_FUNCTION(Units, GetUnits);
+	PUBLIC_FUNCTION(int, GetVisitedDrawablesCount);
+	PUBLIC_FUNCTION(int, GetCulledDrawablesCount);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 }
@@ -224,3 +224,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Component);
+CLASS_SERIALIZATION_META(o2::Component)
+{
+	SERIALIZABLE_FIELD(mId);
+	SERIALIZABLE_FIELD_DEFAULT(mEnabled, true);
+}
+END_META;
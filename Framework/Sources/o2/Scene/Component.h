@@ -119,6 +119,12 @@ namespace o2
 		// It is called when component started working on first update frame
 		virtual void OnStart() {}
 
+		// It is called when actor was taken from scene's pool and restored to prototype values. Resets runtime state
+		virtual void OnSpawned() {}
+
+		// It is called when actor was returned into scene's pool
+		virtual void OnDespawned() {}
+
 		// Updates component enable
 		virtual void UpdateEnabled();
 
@@ -251,6 +257,8 @@ CLASS_METHODS_META(o2::Component)
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PROTECTED_FUNCTION(void, OnStart);
+	PROTECTED_FUNCTION(void, OnSpawned);
+	PROTECTED_FUNCTION(void, OnDespawned);
 	PROTECTED_FUNCTION(void, UpdateEnabled);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
@@ -268,6 +268,12 @@ namespace o2
 		UnregTrack(player, player->GetTrack()->path);
 	}
 
+	void AnimationComponent::OnStateMaskChanged(AnimationState* state)
+	{
+		for (auto val : mValues)
+			val->UpdateMaskWeights(state);
+	}
+
 	void AnimationComponent::OnStatesListChanged()
 	{
 		auto statesCopy = mStates;
@@ -292,23 +298,50 @@ namespace o2
 		blendOnState->blend = 1.0f - cf;
 	}
 
+	void AnimationComponent::ITrackMixer::UpdateMaskWeights(AnimationState* state)
+	{
+		float weight = state->mask.GetNodeWeight(path);
+		for (int i = 0; i < states.Count(); i++)
+		{
+			if (states[i] == state)
+				maskWeights[i] = weight;
+		}
+	}
+
+	float AnimationComponent::ITrackMixer::CalculateWeights()
+	{
+		int count = states.Count();
+		weights.Resize(count);
+
+		AnimationState* const* statesData = states.Data();
+		const float* maskWeightsData = maskWeights.Data();
+		float* weightsData = weights.Data();
+
+		float weightsSum = 0.0f;
+		for (int i = 0; i < count; i++)
+		{
+			weightsData[i] = statesData[i]->mWeight*statesData[i]->blend*maskWeightsData[i];
+			weightsSum += weightsData[i];
+		}
+
+		return weightsSum;
+	}
+
 	template<>
 	void AnimationComponent::TrackMixer<int>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<int>::Player* firstValue = tracks[0].second;
+		float weightsSum = CalculateWeights();
+		if (weightsSum < FLT_EPSILON)
+			return;
 
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		float valueSum = (float)firstValue->GetValue();
+		const float* weightsData = weights.Data();
+		AnimationTrack<int>::Player* const* playersData = players.Data();
 
-		for (int i = 1; i < tracks.Count(); i++)
-		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<int>::Player* value = tracks[i].second;
+		float valueSum = 0.0f;
 
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += (float)value->GetValue();
-		}
+		int count = players.Count();
+		for (int i = 0; i < count; i++)
+			valueSum += (float)playersData[i]->GetValue()*weightsData[i];
 
 		int resValue = Math::RoundToInt(valueSum / weightsSum);
 		target->SetValue(resValue);
@@ -317,24 +350,30 @@ namespace o2
 	template<>
 	void AnimationComponent::TrackMixer<bool>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<bool>::Player* firstValue = tracks[0].second;
-	
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		float valueSum = firstValue->GetValue() ? 1.0f : 0.0f;
-	
-		for (int i = 1; i < tracks.Count(); i++)
+		float weightsSum = CalculateWeights();
+		if (weightsSum < FLT_EPSILON)
+			return;
+
+		const float* weightsData = weights.Data();
+		AnimationTrack<bool>::Player* const* playersData = players.Data();
+
+		float valueSum = 0.0f;
+
+		int count = players.Count();
+		for (int i = 0; i < count; i++)
 		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<bool>::Player* value = tracks[i].second;
-	
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += value->GetValue() ? 1.0f : 0.0f;
+			if (playersData[i]->GetValue())
+				valueSum += weightsData[i];
 		}
-	
+
 		bool resValue = (valueSum / weightsSum) > 0.5f;
 		target->SetValue(resValue);
 	}
 }
 
 DECLARE_CLASS(o2::AnimationComponent);
+CLASS_SERIALIZATION_META(o2::AnimationComponent)
+{
+	SERIALIZABLE_FIELD(mStates);
+}
+END_META;
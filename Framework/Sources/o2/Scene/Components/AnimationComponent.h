@@ -111,6 +111,10 @@ namespace o2
 			// Value path
 			String path;
 
+			Vector<AnimationState*> states;      // Animation states of tracks, indices are same as tracks players indices
+			Vector<float>           maskWeights; // States masks weights for path, resolved when tracks or masks are changed
+			Vector<float>           weights;     // Result tracks weights buffer, calculated on each update
+
 		public:
 			virtual ~ITrackMixer() {}
 
@@ -122,6 +126,12 @@ namespace o2
 
 			// Returns is agent hasn't no values
 			virtual bool IsEmpty() const = 0;
+
+			// Resolves mask weights of tracks from state
+			void UpdateMaskWeights(AnimationState* state);
+
+			// Calculates result weights of tracks and returns sum of them
+			float CalculateWeights();
 		};
 
 		// ------------------------------
@@ -131,8 +141,8 @@ namespace o2
 		struct TrackMixer: public ITrackMixer
 		{
 		public:
-			Vector<Pair<AnimationState*, typename AnimationTrack<_type>::Player*>> tracks; // Animation tracks associated with animation states
-			
+			Vector<typename AnimationTrack<_type>::Player*> players; // Animation tracks players, indices are same as states indices
+
 			IValueProxy<_type>* target = nullptr; // Target value proxy
 
 		public:
@@ -142,6 +152,9 @@ namespace o2
 			// Updates value and blend
 			void Update() override;
 
+			// Adds track player from animation state
+			void AddTrack(AnimationState* state, typename AnimationTrack<_type>::Player* player);
+
 			// Removes Animation track from agent
 			void RemoveTrack(IAnimationTrack::IPlayer* track) override;
 
@@ -185,6 +198,9 @@ namespace o2
 		// It is called when track is removing from animation state, unregisters track player from mixer
 		void OnStateAnimationTrackRemoved(AnimationState* state, IAnimationTrack::IPlayer* player);
 
+		// It is called when state's mask was changed, updates mixers masks weights
+		void OnStateMaskChanged(AnimationState* state);
+
 		// It is called from editor, refreshes states
 		void OnStatesListChanged();
 
@@ -211,7 +227,7 @@ namespace o2
 					return;
 				}
 
-				agent->tracks.Add({ state, player });
+				agent->AddTrack(state, player);
 				return;
 			}
 		}
@@ -219,7 +235,7 @@ namespace o2
 		auto* newAgent = mnew TrackMixer <_type>();
 		mValues.Add(newAgent);
 		newAgent->path = path;
-		newAgent->tracks.Add({ state, player });
+		newAgent->AddTrack(state, player);
 
 		const FieldInfo* fieldInfo = nullptr;
 		auto fieldPtr = (_type*)GetType().GetFieldPtr(mOwner, path, fieldInfo);
@@ -243,13 +259,29 @@ namespace o2
 	template<typename _type>
 	bool AnimationComponent::TrackMixer<_type>::IsEmpty() const
 	{
-		return tracks.IsEmpty();
+		return players.IsEmpty();
+	}
+
+	template<typename _type>
+	void AnimationComponent::TrackMixer<_type>::AddTrack(AnimationState* state, typename AnimationTrack<_type>::Player* player)
+	{
+		states.Add(state);
+		players.Add(player);
+		maskWeights.Add(state->mask.GetNodeWeight(path));
 	}
 
 	template<typename _type>
 	void AnimationComponent::TrackMixer<_type>::RemoveTrack(IAnimationTrack::IPlayer* value)
 	{
-		tracks.RemoveAll([&](const auto& x) { return x.second == value; });
+		for (int i = players.Count() - 1; i >= 0; i--)
+		{
+			if (players[i] == value)
+			{
+				states.RemoveAt(i);
+				players.RemoveAt(i);
+				maskWeights.RemoveAt(i);
+			}
+		}
 	}
 
 	template<>
@@ -261,20 +293,18 @@ namespace o2
 	template<typename _type>
 	void AnimationComponent::TrackMixer<_type>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<_type>::Player* firstValue = tracks[0].second;
+		float weightsSum = CalculateWeights();
+		if (weightsSum < FLT_EPSILON)
+			return;
 
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		_type valueSum = firstValue->GetValue();
+		const float* weightsData = weights.Data();
+		typename AnimationTrack<_type>::Player* const* playersData = players.Data();
 
-		for (int i = 1; i < tracks.Count(); i++)
-		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<_type>::Player* value = tracks[i].second;
+		_type valueSum = playersData[0]->GetValue()*weightsData[0];
 
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += value->GetValue();
-		}
+		int count = players.Count();
+		for (int i = 1; i < count; i++)
+			valueSum += playersData[i]->GetValue()*weightsData[i];
 
 		_type resValue = valueSum / weightsSum;
 		target->SetValue(resValue);
@@ -324,6 +354,7 @@ CLASS_METHODS_META(o2::AnimationComponent)
 	PROTECTED_FUNCTION(void, UnregTrack, IAnimationTrack::IPlayer*, const String&);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackAdded, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackRemoved, AnimationState*, IAnimationTrack::IPlayer*);
+	PROTECTED_FUNCTION(void, OnStateMaskChanged, AnimationState*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
 }
 END_META;
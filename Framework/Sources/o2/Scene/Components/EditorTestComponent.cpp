@@ -32,5 +32,61 @@ ENUM_META(o2::EditorTestComponent::TestEnum)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::EditorTestComponent);
+CLASS_SERIALIZATION_META(o2::EditorTestComponent)
+{
+	SERIALIZABLE_FIELD(mVecs);
+	SERIALIZABLE_FIELD(mInteger);
+	SERIALIZABLE_FIELD(mFloat);
+	SERIALIZABLE_FIELD(mString);
+	SERIALIZABLE_FIELD(mWString);
+	SERIALIZABLE_FIELD(mBool);
+	SERIALIZABLE_FIELD(mImageAsset);
+	SERIALIZABLE_FIELD(mActorAsset);
+	SERIALIZABLE_FIELD(mDataAsset);
+	SERIALIZABLE_FIELD(mAnimationAsset);
+	SERIALIZABLE_FIELD(spritex);
+	SERIALIZABLE_FIELD_DEFAULT(mSprite, mnew Sprite());
+	SERIALIZABLE_FIELD_DEFAULT(mActor, nullptr);
+	SERIALIZABLE_FIELD(mTags);
+	SERIALIZABLE_FIELD(mLayer);
+	SERIALIZABLE_FIELD_DEFAULT(mComponent, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mImageComponent, nullptr);
+	SERIALIZABLE_FIELD(mColor);
+	SERIALIZABLE_FIELD(mVec2F);
+	SERIALIZABLE_FIELD(mVec2I);
+	SERIALIZABLE_FIELD(mVertex);
+	SERIALIZABLE_FIELD(mRectF);
+	SERIALIZABLE_FIELD(mRectI);
+	SERIALIZABLE_FIELD(mBorderF);
+	SERIALIZABLE_FIELD(mBorderI);
+	SERIALIZABLE_FIELD_DEFAULT(mCurve, Curve::EaseInOut());
+	SERIALIZABLE_FIELD(mTestInside);
+	SERIALIZABLE_FIELD(mTestEnum);
+	SERIALIZABLE_FIELD_DEFAULT(mTestInsidePtr, nullptr);
+	SERIALIZABLE_FIELD(mIntVector);
+	SERIALIZABLE_FIELD(mTestInsideVector);
+	SERIALIZABLE_FIELD(mTestInsideptrsVector);
+	SERIALIZABLE_FIELD(mActorVector);
+	SERIALIZABLE_FIELD(mAssetsVector);
+	SERIALIZABLE_FIELD(mVectorOfVector);
+	SERIALIZABLE_FIELD(mDictionary);
+	SERIALIZABLE_FIELD(mFloat2);
+	SERIALIZABLE_FIELD(mFloat3);
+	SERIALIZABLE_FIELD(mFloat4);
+	SERIALIZABLE_FIELD(mFloat5);
+	SERIALIZABLE_FIELD(mFloat6);
+	SERIALIZABLE_FIELD(mFloat7);
+	SERIALIZABLE_FIELD(mFloat8);
+	SERIALIZABLE_FIELD(mFloat9);
+}
+END_META;
 
 DECLARE_CLASS(o2::EditorTestComponent::TestInside);
+CLASS_SERIALIZATION_META(o2::EditorTestComponent::TestInside)
+{
+	SERIALIZABLE_FIELD(mFloat);
+	SERIALIZABLE_FIELD(mString);
+	SERIALIZABLE_FIELD(mWString);
+	SERIALIZABLE_FIELD(mBool);
+}
+END_META;
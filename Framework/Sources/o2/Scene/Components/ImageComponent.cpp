@@ -79,9 +79,16 @@ namespace o2
 		return "ui/UI4_image_component.png";
 	}
 
+	bool ImageComponent::GetSceneDrawableBounds(RectF& bounds) const
+	{
+		bounds = GetAxisAlignedRect();
+		return true;
+	}
+
 	void ImageComponent::OnTransformUpdated()
 	{
 		SetBasis(mOwner->transform->GetWorldBasis());
+		OnSceneDrawableBoundsChanged();
 	}
 
 	void ImageComponent::SetOwnerActor(Actor* actor)
@@ -102,3 +109,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ImageComponent);
+CLASS_SERIALIZATION_META(o2::ImageComponent)
+{
+}
+END_META;
@@ -56,6 +56,9 @@ namespace o2
 		// Sets actor's size as image size
 		void FitActorByImage() const;
 
+		// Returns world axis aligned bounds of sprite
+		bool GetSceneDrawableBounds(RectF& bounds) const override;
+
 		// Returns name of component
 		static String GetName();
 
@@ -97,6 +100,7 @@ CLASS_METHODS_META(o2::ImageComponent)
 
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, FitActorByImage);
+	PUBLIC_FUNCTION(bool, GetSceneDrawableBounds, RectF&);
 	PUBLIC_STATIC_FUNCTION(String, GetName);
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
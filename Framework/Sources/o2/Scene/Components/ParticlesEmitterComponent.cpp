@@ -2,9 +2,11 @@
 #include "ParticlesEmitterComponent.h"
 
 #include "o2/Scene/Actor.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 
 namespace o2
 {
+	Vector<ParticlesEmitterComponent*> ParticlesEmitterComponent::mUpdateQueue;
 
 	ParticlesEmitterComponent::ParticlesEmitterComponent()
 	{}
@@ -14,7 +16,15 @@ namespace o2
 	{}
 
 	ParticlesEmitterComponent::~ParticlesEmitterComponent()
-	{}
+	{
+		if (mUpdateQueueIndex >= 0)
+		{
+			auto last = mUpdateQueue.Last();
+			mUpdateQueue[mUpdateQueueIndex] = last;
+			last->mUpdateQueueIndex = mUpdateQueueIndex;
+			mUpdateQueue.PopBack();
+		}
+	}
 
 	ParticlesEmitterComponent& ParticlesEmitterComponent::operator=(const ParticlesEmitterComponent& other)
 	{
@@ -25,12 +35,45 @@ namespace o2
 
 	void ParticlesEmitterComponent::Draw()
 	{
+		// Emitter was updated outside of scene update, process queue before drawing
+		if (mUpdateQueueIndex >= 0)
+			UpdateQueuedEmitters();
+
 		ParticlesEmitter::Draw();
 	}
 
 	void ParticlesEmitterComponent::Update(float dt)
 	{
-		ParticlesEmitter::Update(dt);
+		if (mUpdateQueueIndex < 0)
+		{
+			mUpdateQueueIndex = mUpdateQueue.Count();
+			mUpdateQueue.Add(this);
+			mQueuedUpdateDt = 0.0f;
+		}
+
+		mQueuedUpdateDt += dt;
+	}
+
+	void ParticlesEmitterComponent::UpdateQueuedEmitters()
+	{
+		if (mUpdateQueue.IsEmpty())
+			return;
+
+		// Time, meshes and textures are updated on main thread, simulation is independent for each emitter
+		Vector<ParticlesEmitterComponent*> emitters;
+		for (auto emitter : mUpdateQueue)
+		{
+			emitter->mUpdateQueueIndex = -1;
+
+			if (emitter->BeginUpdate(emitter->mQueuedUpdateDt))
+				emitters.Add(emitter);
+		}
+
+		mUpdateQueue.Clear();
+
+		o2ThreadPool.ParallelFor(emitters.Count(), [&](int idx) {
+			emitters[idx]->UpdateSimulation(emitters[idx]->mQueuedUpdateDt);
+		});
 	}
 
 	String ParticlesEmitterComponent::GetName()
@@ -53,6 +96,21 @@ namespace o2
 		basis = mOwner->transform->GetWorldBasis();
 	}
 
+	void ParticlesEmitterComponent::OnAddToScene()
+	{
+		DrawableComponent::OnAddToScene();
+		ResetRandom();
+	}
+
+	UInt ParticlesEmitterComponent::GetDefaultRandomSeed() const
+	{
+		if (!mOwner)
+			return ParticlesEmitter::GetDefaultRandomSeed();
+
+		SceneUID id = mOwner->GetID();
+		return (UInt)(id ^ (id >> 32));
+	}
+
 	void ParticlesEmitterComponent::OnDeserialized(const DataValue& node)
 	{
 		DrawableComponent::OnDeserialized(node);
@@ -62,3 +120,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ParticlesEmitterComponent);
+CLASS_SERIALIZATION_META(o2::ParticlesEmitterComponent)
+{
+}
+END_META;
@@ -20,9 +20,12 @@ namespace o2
 		// Draw particle system
 		void Draw() override;
 
-		// Updates component
+		// Queues emitter for parallel update, it is processed in UpdateQueuedEmitters
 		void Update(float dt) override;
 
+		// Updates queued emitters in parallel on thread pool. Called by scene after actors update and before drawing
+		static void UpdateQueuedEmitters();
+
 		// Returns name of component
 		static String GetName();
 
@@ -32,10 +35,22 @@ namespace o2
 		// Returns name of component icon
 		static String GetIcon();
 
+	protected:
+		static Vector<ParticlesEmitterComponent*> mUpdateQueue; // Emitters queued for update in current frame
+
+		int   mUpdateQueueIndex = -1; // Index in update queue, -1 when not queued
+		float mQueuedUpdateDt = 0.0f; // Accumulated delta time for queued update
+
 	protected:
 		// It is called when actor's transform was changed
 		void OnTransformUpdated();
 
+		// It is called when actor was included to scene, restarts random sequence with owner's id
+		void OnAddToScene() override;
+
+		// Returns owner actor's id based seed, so different emitters have different sequences between loadings
+		UInt GetDefaultRandomSeed() const override;
+
 		// It is called when object was deserialized
 		void OnDeserialized(const DataValue& node) override;
 	};
@@ -49,6 +64,8 @@ CLASS_BASES_META(o2::ParticlesEmitterComponent)
 END_META;
 CLASS_FIELDS_META(o2::ParticlesEmitterComponent)
 {
+	PROTECTED_FIELD(mUpdateQueueIndex).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mQueuedUpdateDt).DEFAULT_VALUE(0.0f);
 }
 END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterComponent)
@@ -56,10 +73,13 @@ CLASS_METHODS_META(o2::ParticlesEmitterComponent)
 
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, Update, float);
+	PUBLIC_STATIC_FUNCTION(void, UpdateQueuedEmitters);
 	PUBLIC_STATIC_FUNCTION(String, GetName);
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, OnTransformUpdated);
+	PROTECTED_FUNCTION(void, OnAddToScene);
+	PROTECTED_FUNCTION(UInt, GetDefaultRandomSeed);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
@@ -78,3 +78,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::DrawableComponent);
+CLASS_SERIALIZATION_META(o2::DrawableComponent)
+{
+}
+END_META;
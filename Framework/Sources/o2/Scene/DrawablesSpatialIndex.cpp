@@ -0,0 +1,202 @@
+#include "o2/stdafx.h"
+#include "DrawablesSpatialIndex.h"
+
+#include "o2/Scene/ISceneDrawable.h"
+
+namespace o2
+{
+	DrawablesSpatialIndex::DrawablesSpatialIndex(float cellSize /*= 512.0f*/, int maxCellsPerDrawable /*= 64*/):
+		mCellSize(cellSize), mMaxCellsPerDrawable(maxCellsPerDrawable)
+	{}
+
+	void DrawablesSpatialIndex::SetCellSize(float cellSize)
+	{
+		mCellSize = Math::Max(cellSize, 1.0f);
+
+		mCells.clear();
+		mUnboundedDrawables.Clear();
+
+		for (auto drawable : mAllDrawables)
+			Insert(drawable);
+	}
+
+	float DrawablesSpatialIndex::GetCellSize() const
+	{
+		return mCellSize;
+	}
+
+	void DrawablesSpatialIndex::Add(ISceneDrawable* drawable)
+	{
+		if (drawable->mSpatialIndexPos >= 0)
+			return;
+
+		drawable->mSpatialIndexPos = mAllDrawables.Count();
+		mAllDrawables.Add(drawable);
+
+		Insert(drawable);
+	}
+
+	void DrawablesSpatialIndex::Remove(ISceneDrawable* drawable)
+	{
+		int pos = drawable->mSpatialIndexPos;
+		if (pos < 0)
+			return;
+
+		Erase(drawable);
+
+		ISceneDrawable* last = mAllDrawables.Last();
+		mAllDrawables[pos] = last;
+		last->mSpatialIndexPos = pos;
+		mAllDrawables.PopBack();
+
+		drawable->mSpatialIndexPos = -1;
+	}
+
+	void DrawablesSpatialIndex::Update(ISceneDrawable* drawable)
+	{
+		if (drawable->mSpatialIndexPos < 0)
+			return;
+
+		RectF bounds;
+		bool hasBounds = drawable->GetSceneDrawableBounds(bounds);
+
+		if (hasBounds && !drawable->mSpatialUnbounded && GetCellsRange(bounds) == drawable->mSpatialCells)
+			return;
+
+		Erase(drawable);
+		Insert(drawable);
+	}
+
+	void DrawablesSpatialIndex::Clear()
+	{
+		for (auto drawable : mAllDrawables)
+			drawable->mSpatialIndexPos = -1;
+
+		mAllDrawables.Clear();
+		mUnboundedDrawables.Clear();
+		mCells.clear();
+	}
+
+	int DrawablesSpatialIndex::Query(const RectF& rect, Vector<ISceneDrawable*>& result)
+	{
+		mQueryIdx++;
+
+		int visited = 0;
+
+		for (auto drawable : mUnboundedDrawables)
+		{
+			visited++;
+
+			RectF bounds;
+			if (!drawable->GetSceneDrawableBounds(bounds) || bounds.IsIntersects(rect))
+				result.Add(drawable);
+		}
+
+		RectI range = GetCellsRange(rect);
+		Int64 cellsCount = ((Int64)range.right - range.left + 1)*((Int64)range.top - range.bottom + 1);
+
+		auto processCell = [&](const Vector<ISceneDrawable*>& cell)
+		{
+			for (auto drawable : cell)
+			{
+				if (drawable->mSpatialQueryIdx == mQueryIdx)
+					continue;
+
+				drawable->mSpatialQueryIdx = mQueryIdx;
+				visited++;
+
+				RectF bounds;
+				drawable->GetSceneDrawableBounds(bounds);
+				if (bounds.IsIntersects(rect))
+					result.Add(drawable);
+			}
+		};
+
+		// When query rectangle covers more cells than exists, it is cheaper to iterate existing cells
+		if (cellsCount > (Int64)mCells.size())
+		{
+			for (auto& cell : mCells)
+			{
+				int x = (int)(cell.first >> 32), y = (int)(cell.first & 0xFFFFFFFF);
+				if (x >= range.left && x <= range.right && y >= range.bottom && y <= range.top)
+					processCell(cell.second);
+			}
+		}
+		else
+		{
+			for (int x = range.left; x <= range.right; x++)
+			{
+				for (int y = range.bottom; y <= range.top; y++)
+				{
+					auto fnd = mCells.find(GetCellKey(x, y));
+					if (fnd != mCells.end())
+						processCell(fnd->second);
+				}
+			}
+		}
+
+		return visited;
+	}
+
+	RectI DrawablesSpatialIndex::GetCellsRange(const RectF& rect) const
+	{
+		return RectI(Math::FloorToInt(rect.left/mCellSize), Math::FloorToInt(rect.top/mCellSize),
+					 Math::FloorToInt(rect.right/mCellSize), Math::FloorToInt(rect.bottom/mCellSize));
+	}
+
+	UInt64 DrawablesSpatialIndex::GetCellKey(int x, int y)
+	{
+		return ((UInt64)(UInt)x << 32) | (UInt64)(UInt)y;
+	}
+
+	void DrawablesSpatialIndex::Insert(ISceneDrawable* drawable)
+	{
+		RectF bounds;
+		if (drawable->GetSceneDrawableBounds(bounds))
+		{
+			RectI range = GetCellsRange(bounds);
+			Int64 cellsCount = ((Int64)range.right - range.left + 1)*((Int64)range.top - range.bottom + 1);
+
+			if (cellsCount <= mMaxCellsPerDrawable)
+			{
+				drawable->mSpatialCells = range;
+				drawable->mSpatialUnbounded = false;
+
+				for (int x = range.left; x <= range.right; x++)
+				{
+					for (int y = range.bottom; y <= range.top; y++)
+						mCells[GetCellKey(x, y)].Add(drawable);
+				}
+
+				return;
+			}
+		}
+
+		drawable->mSpatialUnbounded = true;
+		mUnboundedDrawables.Add(drawable);
+	}
+
+	void DrawablesSpatialIndex::Erase(ISceneDrawable* drawable)
+	{
+		if (drawable->mSpatialUnbounded)
+		{
+			mUnboundedDrawables.Remove(drawable);
+			return;
+		}
+
+		const RectI& range = drawable->mSpatialCells;
+		for (int x = range.left; x <= range.right; x++)
+		{
+			for (int y = range.bottom; y <= range.top; y++)
+			{
+				auto fnd = mCells.find(GetCellKey(x, y));
+				if (fnd == mCells.end())
+					continue;
+
+				fnd->second.Remove(drawable);
+				if (fnd->second.IsEmpty())
+					mCells.erase(fnd);
+			}
+		}
+	}
+}
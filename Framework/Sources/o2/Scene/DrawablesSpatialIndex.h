@@ -0,0 +1,69 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <unordered_map>
+
+namespace o2
+{
+	class ISceneDrawable;
+
+	// -------------------------------------------------------------------------------------------
+	// Uniform grid spatial index of scene drawables. Drawable is registered in all cells covered
+	// by it's world axis aligned bounds. Drawables without bounds or with too large bounds are
+	// stored in separated list and always returned by query
+	// -------------------------------------------------------------------------------------------
+	class DrawablesSpatialIndex
+	{
+	public:
+		// Default constructor
+		DrawablesSpatialIndex(float cellSize = 512.0f, int maxCellsPerDrawable = 64);
+
+		// Sets cell size and rebuilds index
+		void SetCellSize(float cellSize);
+
+		// Returns cell size
+		float GetCellSize() const;
+
+		// Adds drawable into index
+		void Add(ISceneDrawable* drawable);
+
+		// Removes drawable from index
+		void Remove(ISceneDrawable* drawable);
+
+		// Updates drawable cells by actual bounds
+		void Update(ISceneDrawable* drawable);
+
+		// Removes all drawables
+		void Clear();
+
+		// Collects drawables intersecting rectangle into result. Each drawable is returned once. Returns count of visited drawables
+		int Query(const RectF& rect, Vector<ISceneDrawable*>& result);
+
+	protected:
+		typedef std::unordered_map<UInt64, Vector<ISceneDrawable*>> CellsMap;
+
+		float mCellSize;            // Size of grid cell in world units
+		int   mMaxCellsPerDrawable; // Drawables covering more cells are stored in unbounded list
+
+		CellsMap                mCells;              // Grid cells by packed coordinates
+		Vector<ISceneDrawable*> mUnboundedDrawables; // Drawables without bounds or with too large bounds
+		Vector<ISceneDrawable*> mAllDrawables;       // All drawables in index, used for rebuilding
+
+		int mQueryIdx = 0; // Current query index, used for skipping duplicates
+
+	protected:
+		// Returns range of cells covered by rectangle
+		RectI GetCellsRange(const RectF& rect) const;
+
+		// Returns packed cell key
+		static UInt64 GetCellKey(int x, int y);
+
+		// Puts drawable into cells or unbounded list by actual bounds
+		void Insert(ISceneDrawable* drawable);
+
+		// Removes drawable from cells or unbounded list
+		void Erase(ISceneDrawable* drawable);
+	};
+}
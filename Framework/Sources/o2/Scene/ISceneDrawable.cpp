@@ -50,7 +50,13 @@ namespace o2
 	void ISceneDrawable::OnDisabled()
 	{
 		if (auto layer = GetSceneDrawableSceneLayer())
-			layer->OnDrawableEnabled(this);
+			layer->OnDrawableDisabled(this);
+	}
+
+	void ISceneDrawable::OnSceneDrawableBoundsChanged()
+	{
+		if (auto layer = GetSceneDrawableSceneLayer())
+			layer->OnDrawableBoundsChanged(this);
 	}
 
 	void ISceneDrawable::OnAddToScene()
@@ -81,6 +87,11 @@ namespace o2
 			layer->SetLastByDepth(this);
 	}
 
+	bool ISceneDrawable::GetSceneDrawableBounds(RectF& bounds) const
+	{
+		return false;
+	}
+
 #if IS_EDITOR
 	SceneEditableObject* ISceneDrawable::GetEditableOwner()
 	{
@@ -98,3 +109,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ISceneDrawable);
+CLASS_SERIALIZATION_META(o2::ISceneDrawable)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mDrawingDepth, 0.0f);
+}
+END_META;
@@ -47,11 +47,20 @@ namespace o2
 		// Sets this drawable as last drawing object in layer with same depth
 		void SetLastOnCurrentDepth();
 
+		// Returns world axis aligned bounds of drawing content. Returns false when bounds are unknown and drawable can't be culled
+		virtual bool GetSceneDrawableBounds(RectF& bounds) const;
+
 		SERIALIZABLE(ISceneDrawable);
 
 	protected:
 		float mDrawingDepth = 0.0f; // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
 
+		RectI mSpatialCells;            // Range of cells in layer's spatial index
+		bool  mSpatialUnbounded = true; // Is drawable placed in unbounded list of layer's spatial index
+		int   mSpatialIndexPos = -1;    // Position in layer's spatial index, -1 when not indexed
+		int   mSpatialQueryIdx = 0;     // Last spatial index query, where drawable was visited
+		int   mLayerOrderIdx = 0;       // Position in layer's enabled drawables list
+
 	protected:
 		// Returns current scene layer
 		virtual SceneLayer* GetSceneDrawableSceneLayer() const = 0;
@@ -59,6 +68,9 @@ namespace o2
 		// Returns is drawable enabled
 		virtual bool IsSceneDrawableEnabled() const = 0;
 
+		// It is called when drawing bounds were changed, updates layer's spatial index
+		void OnSceneDrawableBoundsChanged();
+
 		// Is is called when drawable has enabled
 		void OnEnabled();
 
@@ -71,6 +83,7 @@ namespace o2
 		// It is called when actor was excluded from scene
 		void OnRemoveFromScene();
 
+		friend class DrawablesSpatialIndex;
 		friend class Scene;
 		friend class SceneLayer;
 
@@ -95,6 +108,11 @@ CLASS_FIELDS_META(o2::ISceneDrawable)
 {
 	PUBLIC_FIELD(drawDepth);
 	PROTECTED_FIELD(mDrawingDepth).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mSpatialCells);
+	PROTECTED_FIELD(mSpatialUnbounded).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mSpatialIndexPos).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mSpatialQueryIdx).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mLayerOrderIdx).DEFAULT_VALUE(0);
 }
 END_META;
 CLASS_METHODS_META(o2::ISceneDrawable)
@@ -104,8 +122,10 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	PUBLIC_FUNCTION(void, SetDrawingDepth, float);
 	PUBLIC_FUNCTION(float, GetSceneDrawableDepth);
 	PUBLIC_FUNCTION(void, SetLastOnCurrentDepth);
+	PUBLIC_FUNCTION(bool, GetSceneDrawableBounds, RectF&);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(void, OnSceneDrawableBoundsChanged);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 	PROTECTED_FUNCTION(void, OnAddToScene);
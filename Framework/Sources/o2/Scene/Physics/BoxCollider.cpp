@@ -107,3 +107,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::BoxCollider);
+CLASS_SERIALIZATION_META(o2::BoxCollider)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mSize, Vec2F(1, 1));
+	SERIALIZABLE_FIELD_DEFAULT(mFitByActor, true);
+}
+END_META;
@@ -97,3 +97,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::CircleCollider);
+CLASS_SERIALIZATION_META(o2::CircleCollider)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mRadius, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mFitByActor, true);
+}
+END_META;
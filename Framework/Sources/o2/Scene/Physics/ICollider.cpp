@@ -194,3 +194,12 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ICollider);
+CLASS_SERIALIZATION_META(o2::ICollider)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mFriction, 0.3f);
+	SERIALIZABLE_FIELD_DEFAULT(mDensity, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mRestitution, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mLayer, "Default");
+	SERIALIZABLE_FIELD_DEFAULT(mIsSensor, false);
+}
+END_META;
@@ -273,3 +273,15 @@ ENUM_META(o2::RigidBody::Type)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::RigidBody);
+CLASS_SERIALIZATION_META(o2::RigidBody)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mBodyType, Type::Dynamic);
+	SERIALIZABLE_FIELD_DEFAULT(mMass, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mInertia, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mLinearDamping, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mAngularDamping, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mGravityScale, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mIsBullet, false);
+	SERIALIZABLE_FIELD_DEFAULT(mIsFixedRotation, false);
+}
+END_META;
@@ -8,11 +8,15 @@
 #include "o2/Scene/ActorDataValueConverter.h"
 #include "o2/Scene/CameraActor.h"
 #include "o2/Scene/Component.h"
+#include "o2/Scene/Components/ParticlesEmitterComponent.h"
 #include "o2/Scene/DrawableComponent.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Editor/Attributes/DontDeleteAttribute.h"
+#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 #include "o2/Render/VectorFontEffects.h"
 
 namespace o2
@@ -39,28 +43,52 @@ namespace o2
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
+		UpdateTransforms();
 		UpdateActors(dt);
+
+		ParticlesEmitterComponent::UpdateQueuedEmitters();
 	}
 
 	void Scene::FixedUpdate(float dt)
 	{
 		for (auto actor : mRootActors)
-			actor->FixedUpdate(dt);
+		{
+			if (actor->mPoolIndex < 0)
+				actor->FixedUpdate(dt);
+		}
 
 		for (auto actor : mRootActors)
-			actor->FixedUpdateChildren(dt);
+		{
+			if (actor->mPoolIndex < 0)
+				actor->FixedUpdateChildren(dt);
+		}
 	}
 
-	void Scene::UpdateAddedEntities()
+	const Scene::TransformsPassStats& Scene::GetLastTransformsPassStats() const
 	{
-		auto addedActors = mAddedActors;
+		return mTransformsPassStats;
+	}
 
+	void Scene::UpdateAddedEntities()
+	{
 		mStartActors = mAddedActors;
-
 		mAddedActors.Clear();
 
-		for (auto actor : addedActors)
-			AddActorToScene(actor);
+		for (int i = 0; i < mStartActors.Count(); i++)
+		{
+			if (auto actor = mStartActors[i])
+			{
+				actor->mAddedIndex = -1;
+				actor->mStartIndex = i;
+			}
+		}
+
+		// Actors can be removed while adding others, removed ones are nulled in the list
+		for (int i = 0; i < mStartActors.Count(); i++)
+		{
+			if (auto actor = mStartActors[i])
+				AddActorToScene(actor);
+		}
 	}
 
 	void Scene::UpdateStartingEntities()
@@ -72,7 +100,16 @@ namespace o2
 		mStartComponents.Clear();
 
 		for (auto actor : startActors)
-			actor->OnStart();
+		{
+			if (actor)
+				actor->mStartIndex = -1;
+		}
+
+		for (auto actor : startActors)
+		{
+			if (actor)
+				actor->OnStart();
+		}
 
 		for (auto comp : startComponents)
 			comp->OnStart();
@@ -100,16 +137,118 @@ namespace o2
 
 	void Scene::AddActorToSceneDeferred(Actor* actor)
 	{
+		if (actor->mAddedIndex >= 0)
+			return;
+
+		actor->mAddedIndex = mAddedActors.Count();
 		mAddedActors.Add(actor);
 	}
 
+	void Scene::UpdateTransforms()
+	{
+		mTransformsPassStats = TransformsPassStats();
+
+		if (mDirtyTransforms.IsEmpty())
+			return;
+
+		auto dirtyTransforms = mDirtyTransforms;
+		mDirtyTransforms.Clear();
+
+		for (auto actor : dirtyTransforms)
+		{
+			if (actor)
+				actor->transform->mData->sceneDirtyIndex = -1;
+		}
+
+		// Subtree root is dirty actor without dirty parents. Children of dirty actor are updated with it
+		mTransformsPassActors.Clear();
+		mTransformsPassEntries.Clear();
+		mTransformsPassRanges.Clear();
+
+		for (auto actor : dirtyTransforms)
+		{
+			if (!actor || !actor->transform->IsDirty())
+				continue;
+
+			bool hasDirtyParent = false;
+			for (auto parent = actor->mParent; parent && !hasDirtyParent; parent = parent->mParent)
+				hasDirtyParent = parent->transform->IsDirty();
+
+			if (hasDirtyParent)
+				continue;
+
+			int begin = mTransformsPassEntries.Count();
+			mTransformsPassRanges.Add(begin);
+
+			mTransformsPassActors.Add(actor);
+			mTransformsPassEntries.Add({ actor->transform->mData, actor->mParent ? actor->mParent->transform->mData : nullptr });
+
+			for (int i = begin; i < mTransformsPassActors.Count(); i++)
+			{
+				for (auto child : mTransformsPassActors[i]->mChildren)
+				{
+					// Transforms with own update logic are updated lazily by themselves
+					if (!child->transform->IsUpdatedByScene())
+					{
+						child->transform->SetDirty(true);
+						continue;
+					}
+
+					mTransformsPassActors.Add(child);
+					mTransformsPassEntries.Add({ child->transform->mData, mTransformsPassEntries[i].data });
+				}
+			}
+		}
+
+		if (mTransformsPassEntries.IsEmpty())
+			return;
+
+		mTransformsPassRanges.Add(mTransformsPassEntries.Count());
+
+		mTransformsPassStats.subtrees = mTransformsPassRanges.Count() - 1;
+		mTransformsPassStats.updatedTransforms = mTransformsPassEntries.Count();
+
+		Timer timer;
+
+		int currentFrame = o2Time.GetCurrentFrame();
+		o2ThreadPool.ParallelFor(mTransformsPassRanges.Count() - 1, [&](int idx) {
+			auto entries = mTransformsPassEntries.Data();
+			for (int i = mTransformsPassRanges[idx], end = mTransformsPassRanges[idx + 1]; i < end; i++)
+			{
+				ActorTransformData& data = *entries[i].data;
+				ActorTransform::CalculateRectangle(data);
+				ActorTransform::CalculateTransform(data);
+				ActorTransform::CalculateWorldRectangleAndTransform(data, entries[i].parentData);
+
+				if (data.updateFrame == 0)
+					data.updateFrame = data.dirtyFrame;
+				else
+					data.dirtyFrame = data.updateFrame = currentFrame;
+			}
+		});
+
+		mTransformsPassStats.calculationTime = timer.GetDeltaTime()*1000.0f;
+
+		for (auto actor : mTransformsPassActors)
+			actor->OnTransformUpdated();
+
+		mTransformsPassStats.callbacksTime = timer.GetDeltaTime()*1000.0f;
+	}
+
 	void Scene::UpdateActors(float dt)
 	{
+		// Despawned actors are kept on scene, but not updated
 		for (auto actor : mRootActors)
-			actor->Update(dt);
+		{
+			if (actor->mPoolIndex < 0)
+				actor->Update(dt);
+		}
 
 		for (auto actor : mRootActors)
-			actor->UpdateChildren(dt);
+		{
+			if (actor->mPoolIndex < 0)
+				actor->UpdateChildren(dt);
+		}
 	}
 
 #undef DrawText
@@ -208,7 +347,16 @@ namespace o2
 		if (!actor->mParent)
 			mRootActors.Add(actor);
 
-		mAllActors.Add(actor);
+		if (actor->mSceneIndex < 0)
+		{
+			actor->mSceneIndex = mAllActors.Count();
+			mAllActors.Add(actor);
+			mActorsByID[actor->mId] = actor;
+
+			if (actor->transform->IsDirty() && actor->transform->IsUpdatedByScene())
+				OnTransformDirty(actor);
+		}
+
 		actor->OnAddToScene();
 
 		if constexpr (IS_EDITOR)
@@ -224,10 +372,41 @@ namespace o2
 		if (!actor->mParent)
 		mRootActors.Remove(actor);
 
-		mAllActors.Remove(actor);
+		if (actor->mSceneIndex >= 0)
+		{
+			Actor* last = mAllActors.Last();
+			mAllActors[actor->mSceneIndex] = last;
+			last->mSceneIndex = actor->mSceneIndex;
+			mAllActors.PopBack();
+
+			actor->mSceneIndex = -1;
+
+			auto fnd = mActorsByID.find(actor->mId);
+			if (fnd != mActorsByID.end() && fnd->second == actor)
+				mActorsByID.erase(fnd);
+		}
+
+		auto transformData = actor->transform->mData;
+		if (transformData->sceneDirtyIndex >= 0)
+		{
+			mDirtyTransforms[transformData->sceneDirtyIndex] = nullptr;
+			transformData->sceneDirtyIndex = -1;
+		}
+
+		if (actor->mStartIndex >= 0)
+		{
+			mStartActors[actor->mStartIndex] = nullptr;
+			actor->mStartIndex = -1;
+		}
+
+		if (actor->mAddedIndex >= 0)
+		{
+			mAddedActors[actor->mAddedIndex] = nullptr;
+			actor->mAddedIndex = -1;
+		}
 
-		mStartActors.Remove(actor);
-		mAddedActors.Remove(actor);
+		if (actor->mPoolIndex >= 0)
+			RemoveActorFromPool(actor);
 
 		if constexpr (IS_EDITOR)
 		{
@@ -397,6 +576,30 @@ namespace o2
 		return mRootActors;
 	}
 
+	void Scene::OnActorIDChanged(Actor* actor, SceneUID prevId)
+	{
+		auto fnd = mActorsByID.find(prevId);
+		if (fnd != mActorsByID.end() && fnd->second == actor)
+			mActorsByID.erase(fnd);
+
+		mActorsByID[actor->mId] = actor;
+
+#if IS_EDITOR
+		if (mEditableObjectsIndices.count(actor) > 0)
+			mEditableObjectsByID[actor->mId] = actor;
+#endif
+	}
+
+	void Scene::OnTransformDirty(Actor* actor)
+	{
+		auto transformData = actor->transform->mData;
+		if (transformData->sceneDirtyIndex >= 0)
+			return;
+
+		transformData->sceneDirtyIndex = mDirtyTransforms.Count();
+		mDirtyTransforms.Add(actor);
+	}
+
 	const Vector<Actor*>& Scene::GetAllActors() const
 	{
 		return mAllActors;
@@ -409,7 +612,11 @@ namespace o2
 
 	Actor* Scene::GetActorByID(SceneUID id) const
 	{
-		return mAllActors.FindOrDefault([=](Actor* x) { return x->mId == id; });
+		auto fnd = mActorsByID.find(id);
+		if (fnd != mActorsByID.end())
+			return fnd->second;
+
+		return nullptr;
 	}
 
 	Actor* Scene::GetAssetActorByID(const UID& id)
@@ -444,6 +651,294 @@ namespace o2
 		return nullptr;
 	}
 
+	Actor* Scene::Spawn(const ActorAssetRef& prototype)
+	{
+		if (!prototype)
+			return nullptr;
+
+		auto& pool = mActorsPools[prototype->GetUID()];
+		if (!pool.prototype)
+			pool.prototype = prototype;
+
+		const Actor* prototypeActor = prototype->GetActor();
+
+		if (!pool.actors.IsEmpty())
+		{
+			Actor* actor = pool.actors.PopBack();
+			actor->mPoolIndex = -1;
+
+			mPoolActorsBuffer.Clear();
+			mPoolComponentsBuffer.Clear();
+
+			// Copied actors and components pointers refer to prototype, they are redirected to restored ones
+			RestorePooledActor(actor, prototypeActor, true);
+			prototype->GetClonePlan().FixPointers(mPoolActorsBuffer, mPoolComponentsBuffer);
+
+			actor->SetEnabled(prototypeActor->mEnabled);
+			CallPoolCallbacks(actor, true);
+
+			return actor;
+		}
+
+		Actor* actor = CreatePooledActor(prototype);
+		CallPoolCallbacks(actor, true);
+
+		return actor;
+	}
+
+	void Scene::Despawn(Actor* actor)
+	{
+		if (actor->mPoolIndex >= 0)
+			return;
+
+		auto fnd = mActorsPools.find(actor->mPoolId);
+		if (actor->mPoolId == 0 || fnd == mActorsPools.end() || !actor->IsOnScene())
+		{
+			DestroyActor(actor);
+			return;
+		}
+
+		// Hierarchy could be changed while actor was spawned, or some component can't be restored
+		if (!IsPooledActorRestorable(actor, fnd->second.prototype->GetActor()))
+		{
+			actor->mPoolId = UID(0);
+			DestroyActor(actor);
+			return;
+		}
+
+		CallPoolCallbacks(actor, false);
+		actor->SetEnabled(false);
+
+		auto& actors = fnd->second.actors;
+		actor->mPoolIndex = actors.Count();
+		actors.Add(actor);
+	}
+
+	void Scene::ReserveActorsPool(const ActorAssetRef& prototype, int count)
+	{
+		if (!prototype)
+			return;
+
+		auto& pool = mActorsPools[prototype->GetUID()];
+		if (!pool.prototype)
+			pool.prototype = prototype;
+
+		// Actors with not restorable components are destroyed on despawn, there is no sense to reserve them
+		const Actor* prototypeActor = prototype->GetActor();
+		if (!IsPooledActorRestorable(prototypeActor, prototypeActor))
+			return;
+
+		while (pool.actors.Count() < count)
+		{
+			Actor* actor = CreatePooledActor(prototype);
+			actor->SetEnabled(false);
+
+			actor->mPoolIndex = pool.actors.Count();
+			pool.actors.Add(actor);
+		}
+	}
+
+	void Scene::ClearActorsPools()
+	{
+		for (auto& pool : mActorsPools)
+		{
+			for (auto actor : pool.second.actors)
+			{
+				actor->mPoolIndex = -1;
+				actor->mPoolId = UID(0);
+				DestroyActor(actor);
+			}
+		}
+
+		mActorsPools.Clear();
+	}
+
+	Actor* Scene::CreatePooledActor(const ActorAssetRef& prototype)
+	{
+		Actor* actor = mnew Actor(prototype);
+		actor->mPoolId = prototype->GetUID();
+
+		return actor;
+	}
+
+	void Scene::RemoveActorFromPool(Actor* actor)
+	{
+		auto fnd = mActorsPools.find(actor->mPoolId);
+		if (fnd != mActorsPools.end())
+		{
+			auto& actors = fnd->second.actors;
+
+			Actor* last = actors.Last();
+			actors[actor->mPoolIndex] = last;
+			last->mPoolIndex = actor->mPoolIndex;
+			actors.PopBack();
+		}
+
+		actor->mPoolIndex = -1;
+	}
+
+	bool Scene::IsPooledActorRestorable(const Actor* actor, const Actor* prototype)
+	{
+		if (actor->mChildren.Count() != prototype->mChildren.Count() ||
+			actor->mComponents.Count() != prototype->mComponents.Count())
+		{
+			return false;
+		}
+
+		for (int i = 0; i < actor->mChildren.Count(); i++)
+		{
+			if (!IsPooledActorRestorable(actor->mChildren[i], prototype->mChildren[i]))
+				return false;
+		}
+
+		for (int i = 0; i < actor->mComponents.Count(); i++)
+		{
+			const Type* type = &actor->mComponents[i]->GetType();
+			if (type != &prototype->mComponents[i]->GetType() || !GetPoolComponentFields(type).canRestore)
+				return false;
+		}
+
+		return true;
+	}
+
+	void Scene::RestorePooledActor(Actor* actor, const Actor* prototype, bool isRoot)
+	{
+		mPoolActorsBuffer.Add(actor);
+
+		actor->mName = prototype->mName;
+		actor->transform->CopyFrom(*prototype->transform);
+
+		// Root actor is enabled after restoring
+		if (!isRoot)
+			actor->SetEnabled(prototype->mEnabled);
+
+		for (int i = 0; i < actor->mChildren.Count(); i++)
+			RestorePooledActor(actor->mChildren[i], prototype->mChildren[i], false);
+
+		for (int i = 0; i < actor->mComponents.Count(); i++)
+		{
+			Component* component = actor->mComponents[i];
+			Component* prototypeComponent = prototype->mComponents[i];
+
+			for (auto field : GetPoolComponentFields(&component->GetType()).fields)
+				field->CopyValue(component, prototypeComponent);
+
+			component->SetEnabled(prototypeComponent->mEnabled);
+
+			mPoolComponentsBuffer.Add(component);
+		}
+	}
+
+	const Scene::PoolComponentFields& Scene::GetPoolComponentFields(const Type* type)
+	{
+		auto fnd = mPoolComponentsFields.find(type);
+		if (fnd != mPoolComponentsFields.end())
+			return fnd->second;
+
+		struct helper
+		{
+			static void Collect(const Type* type, PoolComponentFields& poolFields, Vector<const Type*>& checkedTypes)
+			{
+				for (auto& field : type->GetFields())
+				{
+					if (!field.HasAttribute<SerializableAttribute>())
+						continue;
+
+					poolFields.fields.Add(&field);
+
+					// Component's own actor and component pointers are redirected by clone plan
+					if (ActorClonePlan::IsRedirectedPointerType(field.GetType()))
+						continue;
+
+					if (!IsTypeRestorable(field.GetType(), field.HasAttribute<DontDeleteAttribute>(), checkedTypes))
+						poolFields.canRestore = false;
+				}
+
+				for (auto baseType : type->GetBaseTypes())
+				{
+					if (*baseType.type != TypeOf(Component))
+						Collect(baseType.type, poolFields, checkedTypes);
+				}
+			}
+		};
+
+		Vector<const Type*> checkedTypes;
+		auto& poolFields = mPoolComponentsFields[type];
+		helper::Collect(type, poolFields, checkedTypes);
+
+		return poolFields;
+	}
+
+	bool Scene::IsTypeRestorable(const Type* type, bool dontDelete, Vector<const Type*>& checkedTypes)
+	{
+		if (!type)
+			return true;
+
+		switch (type->GetUsage())
+		{
+			case Type::Usage::Pointer:
+			{
+				const Type* unpointedType = dynamic_cast<const PointerType*>(type)->GetUnpointedType();
+				if (unpointedType->IsBasedOn(TypeOf(Actor)) || unpointedType->IsBasedOn(TypeOf(Component)))
+					return false;
+
+				return dontDelete;
+			}
+
+			case Type::Usage::Vector:
+			return IsTypeRestorable(dynamic_cast<const VectorType*>(type)->GetElementType(), dontDelete, checkedTypes);
+
+			case Type::Usage::Map:
+			{
+				auto mapType = dynamic_cast<const MapType*>(type);
+				return IsTypeRestorable(mapType->GetKeyType(), dontDelete, checkedTypes) &&
+					IsTypeRestorable(mapType->GetValueType(), dontDelete, checkedTypes);
+			}
+
+			case Type::Usage::Property:
+			return IsTypeRestorable(dynamic_cast<const PropertyType*>(type)->GetValueType(), dontDelete, checkedTypes);
+
+			default:
+			{
+				if (checkedTypes.Contains(type))
+					return true;
+
+				checkedTypes.Add(type);
+
+				for (auto& field : type->GetFields())
+				{
+					if (field.HasAttribute<SerializableAttribute>() &&
+						!IsTypeRestorable(field.GetType(), field.HasAttribute<DontDeleteAttribute>(), checkedTypes))
+					{
+						return false;
+					}
+				}
+
+				for (auto baseType : type->GetBaseTypes())
+				{
+					if (!IsTypeRestorable(baseType.type, false, checkedTypes))
+						return false;
+				}
+
+				return true;
+			}
+		}
+	}
+
+	void Scene::CallPoolCallbacks(Actor* actor, bool spawned)
+	{
+		for (auto child : actor->mChildren)
+			CallPoolCallbacks(child, spawned);
+
+		for (auto component : actor->mComponents)
+		{
+			if (spawned)
+				component->OnSpawned();
+			else
+				component->OnDespawned();
+		}
+	}
+
 	void Scene::Clear(bool keepDefaultLayer /*= true*/)
 	{
 		auto allActors = mRootActors;
@@ -453,9 +948,28 @@ namespace o2
 		for (auto layer : mLayers)
 			delete layer;
 
+		for (auto actor : mAddedActors)
+		{
+			if (actor)
+				actor->mAddedIndex = -1;
+		}
+
+		for (auto actor : mStartActors)
+		{
+			if (actor)
+				actor->mStartIndex = -1;
+		}
+
+		for (auto actor : mDirtyTransforms)
+		{
+			if (actor)
+				actor->transform->mData->sceneDirtyIndex = -1;
+		}
+
 		mAddedActors.Clear();
 		mStartActors.Clear();
 		mStartComponents.Clear();
+		mDirtyTransforms.Clear();
 		mLayers.Clear();
 		mLayersMap.Clear();
 
@@ -466,6 +980,8 @@ namespace o2
 			delete tag;
 
 		mTags.Clear();
+
+		mActorsPools.Clear();
 	}
 
 	void Scene::ClearCache()
@@ -567,13 +1083,34 @@ namespace o2
 
 	void Scene::RegEditableObject(SceneEditableObject* object)
 	{
+		if (!mEditableObjectsIndices.emplace(object, mEditableObjects.Count()).second)
+			return;
+
 		mEditableObjects.Add(object);
+		mEditableObjectsByID[object->GetID()] = object;
 	}
 
 	void Scene::UnregEditableObject(SceneEditableObject* object)
 	{
 		mChangedObjects.Remove(object);
-		mEditableObjects.Remove(object);
+
+		auto fnd = mEditableObjectsIndices.find(object);
+		if (fnd == mEditableObjectsIndices.end())
+			return;
+
+		int idx = fnd->second;
+		mEditableObjectsIndices.erase(fnd);
+
+		SceneEditableObject* last = mEditableObjects.Last();
+		mEditableObjects[idx] = last;
+		mEditableObjects.PopBack();
+
+		if (last != object)
+			mEditableObjectsIndices[last] = idx;
+
+		auto fndID = mEditableObjectsByID.find(object->GetID());
+		if (fndID != mEditableObjectsByID.end() && fndID->second == object)
+			mEditableObjectsByID.erase(fndID);
 	}
 
 	const Vector<SceneEditableObject*>& Scene::GetAllEditableObjects()
@@ -583,7 +1120,22 @@ namespace o2
 
 	SceneEditableObject* Scene::GetEditableObjectByID(SceneUID id) const
 	{
-		return mEditableObjects.FindOrDefault([=](SceneEditableObject* x) { return x->GetID() == id; });
+		// Entry can be stale when object was unregistered or id changed, check it before using
+		auto fnd = mEditableObjectsByID.find(id);
+		if (fnd != mEditableObjectsByID.end())
+		{
+			if (mEditableObjectsIndices.count(fnd->second) > 0 && fnd->second->GetID() == id)
+				return fnd->second;
+
+			mEditableObjectsByID.erase(fnd);
+		}
+
+		// Id could be changed after registration, search and fix table
+		auto object = mEditableObjects.FindOrDefault([=](SceneEditableObject* x) { return x->GetID() == id; });
+		if (object)
+			mEditableObjectsByID[id] = object;
+
+		return object;
 	}
 
 	int Scene::GetObjectHierarchyIdx(SceneEditableObject* object) const
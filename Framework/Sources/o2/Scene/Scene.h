@@ -7,6 +7,7 @@
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
 #include "o2/Utils/Property.h"
+#include <unordered_map>
 
 // Scene graph access macros
 #define o2Scene Scene::Instance()
@@ -14,6 +15,7 @@
 namespace o2
 {
 	class Actor;
+	class ActorTransformData;
 	class CameraActor;
 	class Component;
 	class SceneLayer;
@@ -44,6 +46,18 @@ namespace o2
 		Function<void()> onLayersListChanged; // It is called when layer added, removed or renamed
 #endif
 
+	public:
+		// Dirty transforms pass statistics of one frame
+		struct TransformsPassStats
+		{
+			int   subtrees = 0;           // Count of updated dirty subtrees
+			int   updatedTransforms = 0;  // Count of updated transforms, including dirty subtrees children
+			float calculationTime = 0.0f; // Transforms calculation time in milliseconds
+			float callbacksTime = 0.0f;   // Actors OnTransformUpdated callbacks time in milliseconds
+
+			bool operator==(const TransformsPassStats& other) const { return subtrees == other.subtrees && updatedTransforms == other.updatedTransforms; }
+		};
+
 	public:
 		// Checks is layer exists
 		bool HasLayer(const String& name) const;
@@ -111,6 +125,18 @@ namespace o2
 		// Returns actor by path (ex "some node/other/target")
 		Actor* FindActor(const String& path);
 
+		// Returns actor from prototype's pool, restored to prototype values. Creates new actor when pool is empty
+		Actor* Spawn(const ActorAssetRef& prototype);
+
+		// Returns spawned actor into pool: disables and keeps it registered on scene. Destroys not pooled actor
+		void Despawn(Actor* actor);
+
+		// Creates despawned actors in prototype's pool until it contains count actors
+		void ReserveActorsPool(const ActorAssetRef& prototype, int count);
+
+		// Destroys all despawned actors and removes pools
+		void ClearActorsPools();
+
 		// Returns component with type in scene
 		template<typename _type>
 		_type* FindActorComponent();
@@ -146,17 +172,47 @@ namespace o2
 		// Updates root actors with fixed delta time
 		void FixedUpdate(float dt);
 
+		// Returns dirty transforms pass statistics of last updated frame. It is empty when there were no dirty transforms
+		const TransformsPassStats& GetLastTransformsPassStats() const;
+
 		IOBJECT(Scene);
 
+	protected:
+		struct ActorsPool
+		{
+			ActorAssetRef  prototype; // Pool actors prototype
+			Vector<Actor*> actors;    // Despawned actors
+
+			bool operator==(const ActorsPool& other) const { return prototype == other.prototype && actors == other.actors; }
+		};
+
+		struct TransformsPassEntry
+		{
+			ActorTransformData*       data;       // Updating transform data
+			const ActorTransformData* parentData; // Parent transform data, null for root actor
+
+			bool operator==(const TransformsPassEntry& other) const { return data == other.data && parentData == other.parentData; }
+		};
+
+		struct PoolComponentFields
+		{
+			Vector<const FieldInfo*> fields;            // Serializable fields, except Component class fields
+			bool                     canRestore = true; // False when some field holds owned or not redirected pointers
+
+			bool operator==(const PoolComponentFields& other) const { return fields == other.fields && canRestore == other.canRestore; }
+		};
+
 	protected:
 		Vector<CameraActor*> mCameras; // List of cameras on scene
 
 		Vector<Actor*> mRootActors; // Scene root actors		
-		Vector<Actor*> mAllActors;  // All scene actors
+		Vector<Actor*> mAllActors;  // All scene actors. Unordered, actors are removed by swapping with last
+
+		std::unordered_map<SceneUID, Actor*> mActorsByID; // All scene actors by id
 
-		Vector<Actor*> mAddedActors; // List of added on previous frame actors. Will receive OnAddToScene at current frame
+		Vector<Actor*> mAddedActors; // List of added on previous frame actors. Will receive OnAddToScene at current frame. Removed actors are nulled
 		
-		Vector<Actor*>     mStartActors;     // List of starting on current frame actors. Will receive OnStart at current frame
+		Vector<Actor*>     mStartActors;     // List of starting on current frame actors. Will receive OnStart at current frame. Removed actors are nulled
 		Vector<Component*> mStartComponents; // List of starting on current frame components. Will receive OnStart at current frame
 
 		Vector<Actor*>     mDestroyActors;     // List of destroying on current frame actors
@@ -170,6 +226,18 @@ namespace o2
 
 		Vector<ActorAssetRef> mCache; // Cached actors assets
 
+		Map<UID, ActorsPool> mActorsPools; // Despawned actors pools by prototype asset id
+
+		Map<const Type*, PoolComponentFields> mPoolComponentsFields; // Restoring components serializable fields by type
+		Vector<Actor*>                        mPoolActorsBuffer;     // Restoring actors buffer, in clone plan order
+		Vector<Component*>                    mPoolComponentsBuffer; // Restoring components buffer, in clone plan order
+
+		Vector<Actor*>              mDirtyTransforms;       // Actors with changed transforms, updated in transforms pass. Removed actors are nulled
+		Vector<Actor*>              mTransformsPassActors;  // Updating actors in transforms pass, subtrees in depth order
+		Vector<TransformsPassEntry> mTransformsPassEntries; // Updating transforms in transforms pass, same order as actors
+		Vector<int>                 mTransformsPassRanges;  // Subtrees begin indices in transforms pass entries and total count at the end
+		TransformsPassStats         mTransformsPassStats;   // Last frame transforms pass statistics
+
 	protected:
 		// Default constructor
 		Scene();
@@ -177,6 +245,10 @@ namespace o2
 		// Destructor
 		~Scene();
 
+		// Updates changed transforms. Changed subtrees are collected into continuous arrays in depth order and
+		// calculated in parallel, parent is always calculated before children
+		void UpdateTransforms();
+
 		// Updates root actors and their children
 		void UpdateActors(float dt);
 
@@ -204,6 +276,35 @@ namespace o2
 		// It is called when actor removing from scene; unregisters from actors list and events list
 		void RemoveActorFromScene(Actor* actor, bool keepEditorObjects = false);
 
+		// It is called when actor's id changed, updates actors by id table
+		void OnActorIDChanged(Actor* actor, SceneUID prevId);
+
+		// It is called when actor's transform changed, registers actor for transforms pass
+		void OnTransformDirty(Actor* actor);
+
+		// Creates new pooled actor from prototype
+		Actor* CreatePooledActor(const ActorAssetRef& prototype);
+
+		// Removes despawned actor from it's pool
+		void RemoveActorFromPool(Actor* actor);
+
+		// Returns is actor's hierarchy matches prototype and all components can be restored by fields copying
+		bool IsPooledActorRestorable(const Actor* actor, const Actor* prototype);
+
+		// Restores actor and children to prototype values, collects actors and components in clone plan order
+		void RestorePooledActor(Actor* actor, const Actor* prototype, bool isRoot);
+
+		// Returns cached serializable fields of component type, except Component class fields
+		const PoolComponentFields& GetPoolComponentFields(const Type* type);
+
+		// Returns is value of type can be restored by assignment. Owned pointers can't be shared with prototype,
+		// pointers to actors and components in containers and nested objects aren't redirected to copies.
+		// Nested objects are checked by serializable fields, checkedTypes prevents endless recursion
+		static bool IsTypeRestorable(const Type* type, bool dontDelete, Vector<const Type*>& checkedTypes);
+
+		// Calls spawn or despawn callbacks for actor's and children components
+		void CallPoolCallbacks(Actor* actor, bool spawned);
+
 		// It is called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
@@ -220,6 +321,7 @@ namespace o2
 		void OnCameraRemovedScene(CameraActor* camera);
 
 		friend class Actor;
+		friend class ActorTransform;
 		friend class Application;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -295,7 +397,10 @@ namespace o2
 		Map<ActorAssetRef, Vector<Actor*>> mPrototypeLinksCache; // Cache of linked to prototypes actors
 
 		Vector<SceneEditableObject*> mChangedObjects;  // Changed actors array
-		Vector<SceneEditableObject*> mEditableObjects; // All scene editable objects
+		Vector<SceneEditableObject*> mEditableObjects; // All scene editable objects. Unordered, objects are removed by swapping with last
+
+		std::unordered_map<SceneEditableObject*, int>              mEditableObjectsIndices; // Editable objects indices in mEditableObjects
+		mutable std::unordered_map<SceneUID, SceneEditableObject*> mEditableObjectsByID;    // Editable objects by id. Entries are checked at search, because ids can be changed outside
 
 		Vector<SceneEditableObject*> mDrawnObjects;           // List of drawn on last frame editable objects
 		bool                         mIsDrawingScene = false; // Sets true when started drawing scene, and false when not
@@ -353,6 +458,7 @@ CLASS_FIELDS_META(o2::Scene)
 	PROTECTED_FIELD(mCameras);
 	PROTECTED_FIELD(mRootActors);
 	PROTECTED_FIELD(mAllActors);
+	PROTECTED_FIELD(mActorsByID);
 	PROTECTED_FIELD(mAddedActors);
 	PROTECTED_FIELD(mStartActors);
 	PROTECTED_FIELD(mStartComponents);
@@ -363,9 +469,20 @@ CLASS_FIELDS_META(o2::Scene)
 	PROTECTED_FIELD(mDefaultLayer);
 	PROTECTED_FIELD(mTags);
 	PROTECTED_FIELD(mCache);
+	PROTECTED_FIELD(mActorsPools);
+	PROTECTED_FIELD(mPoolComponentsFields);
+	PROTECTED_FIELD(mPoolActorsBuffer);
+	PROTECTED_FIELD(mPoolComponentsBuffer);
+	PROTECTED_FIELD(mDirtyTransforms);
+	PROTECTED_FIELD(mTransformsPassActors);
+	PROTECTED_FIELD(mTransformsPassEntries);
+	PROTECTED_FIELD(mTransformsPassRanges);
+	PROTECTED_FIELD(mTransformsPassStats);
 	PROTECTED_FIELD(mPrototypeLinksCache);
 	PROTECTED_FIELD(mChangedObjects);
 	PROTECTED_FIELD(mEditableObjects);
+	PROTECTED_FIELD(mEditableObjectsIndices);
+	PROTECTED_FIELD(mEditableObjectsByID);
 	PROTECTED_FIELD(mDrawnObjects);
 	PROTECTED_FIELD(mIsDrawingScene).DEFAULT_VALUE(false);
 }
@@ -398,6 +515,10 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(Actor*, GetActorByID, SceneUID);
 	PUBLIC_FUNCTION(Actor*, GetAssetActorByID, const UID&);
 	PUBLIC_FUNCTION(Actor*, FindActor, const String&);
+	PUBLIC_FUNCTION(Actor*, Spawn, const ActorAssetRef&);
+	PUBLIC_FUNCTION(void, Despawn, Actor*);
+	PUBLIC_FUNCTION(void, ReserveActorsPool, const ActorAssetRef&, int);
+	PUBLIC_FUNCTION(void, ClearActorsPools);
 	PUBLIC_FUNCTION(void, Clear, bool);
 	PUBLIC_FUNCTION(void, ClearCache);
 	PUBLIC_FUNCTION(void, Load, const String&, bool);
@@ -407,6 +528,8 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
+	PUBLIC_FUNCTION(const TransformsPassStats&, GetLastTransformsPassStats);
+	PROTECTED_FUNCTION(void, UpdateTransforms);
 	PROTECTED_FUNCTION(void, UpdateActors, float);
 	PROTECTED_FUNCTION(void, UpdateAddedEntities);
 	PROTECTED_FUNCTION(void, UpdateStartingEntities);
@@ -416,6 +539,15 @@ CLASS_METHODS_META(o2::Scene)
 	PROTECTED_FUNCTION(void, AddActorToScene, Actor*);
 	PROTECTED_FUNCTION(void, AddActorToSceneDeferred, Actor*);
 	PROTECTED_FUNCTION(void, RemoveActorFromScene, Actor*, bool);
+	PROTECTED_FUNCTION(void, OnActorIDChanged, Actor*, SceneUID);
+	PROTECTED_FUNCTION(void, OnTransformDirty, Actor*);
+	PROTECTED_FUNCTION(Actor*, CreatePooledActor, const ActorAssetRef&);
+	PROTECTED_FUNCTION(void, RemoveActorFromPool, Actor*);
+	PROTECTED_FUNCTION(bool, IsPooledActorRestorable, const Actor*, const Actor*);
+	PROTECTED_FUNCTION(void, RestorePooledActor, Actor*, const Actor*, bool);
+	PROTECTED_FUNCTION(const PoolComponentFields&, GetPoolComponentFields, const Type*);
+	PROTECTED_STATIC_FUNCTION(bool, IsTypeRestorable, const Type*, bool, Vector<const Type*>&);
+	PROTECTED_FUNCTION(void, CallPoolCallbacks, Actor*, bool);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoved, Component*);
 	PROTECTED_FUNCTION(void, OnLayerRenamed, SceneLayer*, const String&);
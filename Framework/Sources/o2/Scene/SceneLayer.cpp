@@ -43,6 +43,30 @@ namespace o2
 		return mEnabledDrawables;
 	}
 
+	int SceneLayer::GetVisibleDrawables(const RectF& rect, Vector<ISceneDrawable*>& result)
+	{
+		if (mEnabledDrawablesOrderDirty)
+			UpdateEnabledDrawablesOrder();
+
+		int begin = result.Count();
+		int visited = mSpatialIndex.Query(rect, result);
+
+		std::sort(result.begin() + begin, result.end(),
+				  [](ISceneDrawable* a, ISceneDrawable* b) { return a->mLayerOrderIdx < b->mLayerOrderIdx; });
+
+		return visited;
+	}
+
+	void SceneLayer::SetCullingCellSize(float size)
+	{
+		mSpatialIndex.SetCellSize(size);
+	}
+
+	float SceneLayer::GetCullingCellSize() const
+	{
+		return mSpatialIndex.GetCellSize();
+	}
+
 	void SceneLayer::RegisterActor(Actor* actor)
 	{
 		mActors.Add(actor);
@@ -113,11 +137,15 @@ namespace o2
 		}
 
 		mEnabledDrawables.Insert(drawable, position);
+		mEnabledDrawablesOrderDirty = true;
+		mSpatialIndex.Add(drawable);
 	}
 
 	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
 	{
 		mEnabledDrawables.Remove(drawable);
+		mEnabledDrawablesOrderDirty = true;
+		mSpatialIndex.Remove(drawable);
 	}
 
 	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
@@ -129,11 +157,28 @@ namespace o2
 			if (mEnabledDrawables[position]->mDrawingDepth > drawable->mDrawingDepth)
 			{
 				mEnabledDrawables.Insert(drawable, position);
+				mEnabledDrawablesOrderDirty = true;
+				mSpatialIndex.Add(drawable);
 				return;
 			}
 		}
 
 		mEnabledDrawables.Add(drawable);
+		mEnabledDrawablesOrderDirty = true;
+		mSpatialIndex.Add(drawable);
+	}
+
+	void SceneLayer::OnDrawableBoundsChanged(ISceneDrawable* drawable)
+	{
+		mSpatialIndex.Update(drawable);
+	}
+
+	void SceneLayer::UpdateEnabledDrawablesOrder()
+	{
+		for (int i = 0; i < mEnabledDrawables.Count(); i++)
+			mEnabledDrawables[i]->mLayerOrderIdx = i;
+
+		mEnabledDrawablesOrderDirty = false;
 	}
 
 
@@ -159,3 +204,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::SceneLayer);
+CLASS_SERIALIZATION_META(o2::SceneLayer)
+{
+	SERIALIZABLE_FIELD(mName);
+}
+END_META;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Scene/DrawablesSpatialIndex.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
@@ -36,6 +37,15 @@ namespace o2
 		// Returns enabled drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Collects enabled drawables intersecting rectangle in drawing order. Returns count of visited drawables
+		int GetVisibleDrawables(const RectF& rect, Vector<ISceneDrawable*>& result);
+
+		// Sets size of spatial index cell, used for culling drawables
+		void SetCullingCellSize(float size);
+
+		// Returns size of spatial index cell, used for culling drawables
+		float GetCullingCellSize() const;
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
@@ -47,6 +57,9 @@ namespace o2
 		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
 		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
 
+		DrawablesSpatialIndex mSpatialIndex;                      // Spatial index of enabled drawables, used for culling
+		bool                  mEnabledDrawablesOrderDirty = true; // Is drawables order indexes needs to be updated
+
 	protected:
 		// Registers actor in list
 		void RegisterActor(Actor* actor);
@@ -78,6 +91,12 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// It is called when drawable bounds were changed, updates spatial index
+		void OnDrawableBoundsChanged(ISceneDrawable* drawable);
+
+		// Updates drawables order indexes by enabled drawables list
+		void UpdateEnabledDrawablesOrder();
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -116,6 +135,8 @@ CLASS_FIELDS_META(o2::SceneLayer)
 	PROTECTED_FIELD(mEnabledActors);
 	PROTECTED_FIELD(mDrawables);
 	PROTECTED_FIELD(mEnabledDrawables);
+	PROTECTED_FIELD(mSpatialIndex);
+	PROTECTED_FIELD(mEnabledDrawablesOrderDirty).DEFAULT_VALUE(true);
 }
 END_META;
 CLASS_METHODS_META(o2::SceneLayer)
@@ -127,6 +148,9 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PUBLIC_FUNCTION(const Vector<Actor*>&, GetEnabledActors);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetDrawables);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	PUBLIC_FUNCTION(int, GetVisibleDrawables, const RectF&, Vector<ISceneDrawable*>&);
+	PUBLIC_FUNCTION(void, SetCullingCellSize, float);
+	PUBLIC_FUNCTION(float, GetCullingCellSize);
 	PROTECTED_FUNCTION(void, RegisterActor, Actor*);
 	PROTECTED_FUNCTION(void, UnregisterActor, Actor*);
 	PROTECTED_FUNCTION(void, OnActorEnabled, Actor*);
@@ -137,5 +161,7 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PROTECTED_FUNCTION(void, OnDrawableEnabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, OnDrawableDisabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, SetLastByDepth, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, OnDrawableBoundsChanged, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, UpdateEnabledDrawablesOrder);
 }
 END_META;
@@ -113,3 +113,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::SceneLayersList);
+CLASS_SERIALIZATION_META(o2::SceneLayersList)
+{
+	SERIALIZABLE_FIELD(mLayers);
+}
+END_META;
@@ -225,5 +225,15 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Tag);
+CLASS_SERIALIZATION_META(o2::Tag)
+{
+	SERIALIZABLE_FIELD(mName);
+}
+END_META;
 
 DECLARE_CLASS(o2::TagGroup);
+CLASS_SERIALIZATION_META(o2::TagGroup)
+{
+	SERIALIZABLE_FIELD(mTags);
+}
+END_META;
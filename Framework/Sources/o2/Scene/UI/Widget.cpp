@@ -9,9 +9,14 @@
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetState.h"
+#include "o2/Utils/System/Time/Time.h"
 
 namespace o2
 {
+	Widget::StatesUpdateStats Widget::mStatesUpdateStats;
+	Widget::StatesUpdateStats Widget::mLastFrameStatesUpdateStats;
+	int Widget::mStatesUpdateStatsFrame = -1;
+
 	Widget::Widget(ActorCreateMode mode /*= ActorCreateMode::Default*/):
 		Actor(mnew WidgetLayout(), mode), layout(dynamic_cast<WidgetLayout*>(transform))
 	{
@@ -142,18 +147,31 @@ namespace o2
 				UpdateSelfTransform();
 			}
 
-			if (!mIsClipped)
+			CheckStatesUpdateStatsFrame();
+			mStatesUpdateStats.updatedWidgets++;
+
+			// Layers have nothing to update, widget skips states updating while no animation is playing.
+			// Playing state sets mHasActiveStates, it is reset when all animations are finished
+			if (!mIsClipped && mHasActiveStates)
 			{
-				for (auto layer : mLayers)
-					layer->Update(dt);
+				mHasActiveStates = false;
 
 				for (auto state : mStates)
 				{
-					if (state)
+					if (state && state->player.IsPlaying())
+					{
 						state->Update(dt);
+						mStatesUpdateStats.updatedStates++;
+
+						if (state->player.IsPlaying())
+							mHasActiveStates = true;
+					}
 				}
 			}
 
+			if (!mHasActiveStates)
+				mStatesUpdateStats.skippedStatesWidgets++;
+
 			for (auto comp : mComponents)
 				comp->Update(dt);
 		}
@@ -308,6 +326,28 @@ namespace o2
 		return "UI";
 	}
 
+	const Widget::StatesUpdateStats& Widget::GetLastFrameStatesUpdateStats()
+	{
+		CheckStatesUpdateStatsFrame();
+		return mLastFrameStatesUpdateStats;
+	}
+
+	void Widget::CheckStatesUpdateStatsFrame()
+	{
+		int frame = o2Time.GetCurrentFrame();
+		if (frame == mStatesUpdateStatsFrame)
+			return;
+
+		// Collected statistics belong to previous frame only if it was the last one, otherwise last frame had no updates
+		if (frame == mStatesUpdateStatsFrame + 1)
+			mLastFrameStatesUpdateStats = mStatesUpdateStats;
+		else
+			mLastFrameStatesUpdateStats = StatesUpdateStats();
+
+		mStatesUpdateStats = StatesUpdateStats();
+		mStatesUpdateStatsFrame = frame;
+	}
+
 	WidgetLayer* Widget::AddLayer(WidgetLayer* layer)
 	{
 		if (layer->mParent)
@@ -686,6 +726,38 @@ namespace o2
 		return GetLayoutData().minSize.y;
 	}
 
+	float Widget::GetCachedMinWidthWithChildren() const
+	{
+		if (!mCachedMinWidthValid)
+		{
+			mCachedMinSizeWithChildren.x = GetMinWidthWithChildren();
+			mCachedMinWidthValid = true;
+		}
+
+		return mCachedMinSizeWithChildren.x;
+	}
+
+	float Widget::GetCachedMinHeightWithChildren() const
+	{
+		if (!mCachedMinHeightValid)
+		{
+			mCachedMinSizeWithChildren.y = GetMinHeightWithChildren();
+			mCachedMinHeightValid = true;
+		}
+
+		return mCachedMinSizeWithChildren.y;
+	}
+
+	void Widget::InvalidateMinSizeCache()
+	{
+		// Parents sizes depends on this, invalidating whole chain
+		for (Widget* widget = this; widget; widget = widget->mParentWidget)
+		{
+			widget->mCachedMinWidthValid = false;
+			widget->mCachedMinHeightValid = false;
+		}
+	}
+
 	float Widget::GetWidthWeightWithChildren() const
 	{
 		return GetLayoutData().weight.x;
@@ -1018,6 +1090,8 @@ namespace o2
 			if (auto widget = dynamic_cast<Widget*>(child))
 				mChildWidgets.Add(widget);
 		}
+
+		InvalidateMinSizeCache();
 	}
 
 	WidgetLayoutData& Widget::GetLayoutData()
@@ -1520,7 +1594,25 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Widget);
+CLASS_SERIALIZATION_META(o2::Widget)
+{
+	SERIALIZABLE_FIELD(mLayers);
+	SERIALIZABLE_FIELD(mStates);
+	SERIALIZABLE_FIELD(mInternalWidgets);
+	SERIALIZABLE_FIELD_DEFAULT(mOverrideDepth, false);
+	SERIALIZABLE_FIELD_DEFAULT(mTransparency, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mIsFocusable, false);
+}
+END_META;
 
 DECLARE_CLASS(o2::Widget::LayersEditable);
+CLASS_SERIALIZATION_META(o2::Widget::LayersEditable)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::Widget::InternalChildrenEditableEditable);
+CLASS_SERIALIZATION_META(o2::Widget::InternalChildrenEditableEditable)
+{
+}
+END_META;
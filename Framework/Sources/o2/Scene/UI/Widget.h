@@ -42,6 +42,15 @@ namespace o2
 		ACCESSOR(WidgetLayer*, layer, String, GetLayer, GetAllLayers);                       // Widget layer accessor by path like "layer/sublayer/target"
 		ACCESSOR(WidgetState*, state, String, GetStateObject, GetAllStates);                 // Widget state accessor by name
 
+	public:
+		// Widgets states update statistics of one frame. All enabled widgets are still updated, only states updating is skipped
+		struct StatesUpdateStats
+		{
+			int updatedWidgets = 0;       // Count of updated enabled widgets
+			int updatedStates = 0;        // Count of updated states with playing animation
+			int skippedStatesWidgets = 0; // Count of updated widgets, which states updating was skipped
+		};
+
 	public:
 		WidgetLayout* const layout; // Widget layout @EDITOR_IGNORE
 
@@ -252,6 +261,9 @@ namespace o2
 		// Returns create menu category in editor
 		static String GetCreateMenuCategory();
 
+		// Returns widgets states update statistics of last finished frame. It is empty when no widgets were updated in that frame
+		static const StatesUpdateStats& GetLastFrameStatesUpdateStats();
+
 		SERIALIZABLE(Widget);
 
 	protected:
@@ -282,10 +294,23 @@ namespace o2
 
 		bool mIsClipped = false; // Is widget fully clipped by some scissors
 
+		bool mHasActiveStates = true; // Is some state animation may be playing. Widget skips states updating while it is false
+
 		RectF mBounds;           // Widget bounds by drawing layers
 		RectF mBoundsWithChilds; // Widget with childs bounds
 
+		mutable Vec2F mCachedMinSizeWithChildren;     // Cached minimal size with children, used by parent layouts
+		mutable bool  mCachedMinWidthValid = false;  // Is cached minimal width with children valid
+		mutable bool  mCachedMinHeightValid = false; // Is cached minimal height with children valid
+
+		static StatesUpdateStats mStatesUpdateStats;          // Current frame states update statistics
+		static StatesUpdateStats mLastFrameStatesUpdateStats; // Last finished frame states update statistics
+		static int               mStatesUpdateStatsFrame;     // Current statistics frame index
+
 	protected:
+		// Finishes states update statistics of previous frames when frame is changed
+		static void CheckStatesUpdateStatsFrame();
+
 		// Updates result read enable flag
 		void UpdateResEnabled() override;
 
@@ -352,6 +377,15 @@ namespace o2
 		// Returns layout height with childer
 		virtual float GetMinHeightWithChildren() const;
 
+		// Returns cached layout width with children, calculates it when cache is invalid
+		float GetCachedMinWidthWithChildren() const;
+
+		// Returns cached layout height with children, calculates it when cache is invalid
+		float GetCachedMinHeightWithChildren() const;
+
+		// Invalidates cached minimal sizes with children of this and parent widgets
+		void InvalidateMinSizeCache();
+
 		// Returns layout width weight with children
 		virtual float GetWidthWeightWithChildren() const;
 
@@ -456,6 +490,7 @@ namespace o2
 		friend class VerticalScrollBar;
 		friend class WidgetLayer;
 		friend class WidgetLayout;
+		friend class WidgetState;
 		friend class Window;
 
 #if IS_EDITOR
@@ -737,8 +772,12 @@ CLASS_FIELDS_META(o2::Widget)
 	PROTECTED_FIELD(mIsFocusable).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mVisibleState).DEFAULT_VALUE(nullptr).DEFAULT_TYPE_ATTRIBUTE(o2::WidgetState).DONT_DELETE_ATTRIBUTE();
 	PROTECTED_FIELD(mIsClipped).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mHasActiveStates).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mBounds);
 	PROTECTED_FIELD(mBoundsWithChilds);
+	PROTECTED_FIELD(mCachedMinSizeWithChildren);
+	PROTECTED_FIELD(mCachedMinWidthValid).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mCachedMinHeightValid).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(layersEditable);
 	PROTECTED_FIELD(internalChildrenEditable);
 }
@@ -804,6 +843,8 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(Widget*, GetInternalWidget, const String&);
 	PUBLIC_FUNCTION(Widget*, FindInternalWidget, const String&);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
+	PUBLIC_STATIC_FUNCTION(const StatesUpdateStats&, GetLastFrameStatesUpdateStats);
+	PROTECTED_STATIC_FUNCTION(void, CheckStatesUpdateStatsFrame);
 	PROTECTED_FUNCTION(void, UpdateResEnabled);
 	PROTECTED_FUNCTION(void, UpdateResEnabledInHierarchy);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
@@ -826,6 +867,9 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(void, OnUnfocused);
 	PROTECTED_FUNCTION(float, GetMinWidthWithChildren);
 	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
+	PROTECTED_FUNCTION(float, GetCachedMinWidthWithChildren);
+	PROTECTED_FUNCTION(float, GetCachedMinHeightWithChildren);
+	PROTECTED_FUNCTION(void, InvalidateMinSizeCache);
 	PROTECTED_FUNCTION(float, GetWidthWeightWithChildren);
 	PROTECTED_FUNCTION(float, GetHeightWeightWithChildren);
 	PROTECTED_FUNCTION(void, UpdateBounds);
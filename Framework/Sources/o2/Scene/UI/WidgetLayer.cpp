@@ -634,3 +634,15 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::WidgetLayer);
+CLASS_SERIALIZATION_META(o2::WidgetLayer)
+{
+	SERIALIZABLE_FIELD(layout);
+	SERIALIZABLE_FIELD(name);
+	SERIALIZABLE_FIELD(interactableLayout);
+	SERIALIZABLE_FIELD(mDrawable);
+	SERIALIZABLE_FIELD_DEFAULT(mTransparency, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mDepth, 0.0f);
+	SERIALIZABLE_FIELD(mChildren);
+	SERIALIZABLE_FIELD_DEFAULT(mUID, Math::Random());
+}
+END_META;
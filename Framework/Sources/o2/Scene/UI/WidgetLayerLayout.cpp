@@ -240,3 +240,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::WidgetLayerLayout);
+CLASS_SERIALIZATION_META(o2::WidgetLayerLayout)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mAnchorMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(mAnchorMax, Vec2F(1, 1));
+	SERIALIZABLE_FIELD_DEFAULT(mOffsetMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(mOffsetMax, Vec2F(0, 0));
+}
+END_META;
@@ -612,6 +612,9 @@ namespace o2
 				parent->transform->SetDirty(fromParent);
 		}
 
+		if (!fromParent && mData->owner)
+			mData->owner->InvalidateMinSizeCache();
+
 		ActorTransform::SetDirty(fromParent);
 	}
 
@@ -625,6 +628,11 @@ namespace o2
 		return RectF();
 	}
 
+	bool WidgetLayout::IsUpdatedByScene() const
+	{
+		return false;
+	}
+
 	void WidgetLayout::Update()
 	{
 		RectF parentWorldRect;
@@ -712,7 +720,7 @@ namespace o2
 	void WidgetLayout::CheckMinMax()
 	{
 		Vec2F resSize = mData->size;
-		Vec2F minSizeWithChildren(mData->owner->GetMinWidthWithChildren(), mData->owner->GetMinHeightWithChildren());
+		Vec2F minSizeWithChildren(mData->owner->GetCachedMinWidthWithChildren(), mData->owner->GetCachedMinHeightWithChildren());
 
 		Vec2F clampSize(Math::Clamp(resSize.x, minSizeWithChildren.x, mData->maxSize.x),
 						Math::Clamp(resSize.y, minSizeWithChildren.y, mData->maxSize.y));
@@ -806,5 +814,20 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::WidgetLayout);
+CLASS_SERIALIZATION_META(o2::WidgetLayout)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::WidgetLayoutData);
+CLASS_SERIALIZATION_META(o2::WidgetLayoutData)
+{
+	SERIALIZABLE_FIELD_DEFAULT(anchorMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(anchorMax, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(offsetMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(offsetMax, Vec2F(10, 10));
+	SERIALIZABLE_FIELD_DEFAULT(minSize, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(maxSize, Vec2F(10000, 10000));
+	SERIALIZABLE_FIELD_DEFAULT(weight, Vec2F(1, 1));
+}
+END_META;
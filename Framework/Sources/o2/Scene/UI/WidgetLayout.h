@@ -274,6 +274,9 @@ namespace o2
 		// Returns parent rectange, or zero when no parent
 		RectF GetParentRectangle() const override;
 
+		// Returns false, layout depends on parent widget and is updated by widget
+		bool IsUpdatedByScene() const override;
+
 		// Floors all local rectangle properties
 		void FloorRectangle();
 
@@ -419,6 +422,7 @@ CLASS_METHODS_META(o2::WidgetLayout)
 	PUBLIC_STATIC_FUNCTION(WidgetLayout, VerStretch, HorAlign, float, float, float, float);
 	PROTECTED_FUNCTION(void, SetOwner, Actor*);
 	PROTECTED_FUNCTION(RectF, GetParentRectangle);
+	PROTECTED_FUNCTION(bool, IsUpdatedByScene);
 	PROTECTED_FUNCTION(void, FloorRectangle);
 	PROTECTED_FUNCTION(void, UpdateOffsetsByCurrentTransform);
 	PROTECTED_FUNCTION(void, CheckMinMax);
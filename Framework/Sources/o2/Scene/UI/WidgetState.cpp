@@ -6,7 +6,9 @@
 namespace o2
 {
 	WidgetState::WidgetState()
-	{}
+	{
+		player.onPlayEvent += THIS_FUNC(OnPlayerStarted);
+	}
 
 	WidgetState::WidgetState(const WidgetState& state):
 		name(state.name), mState(state.mState), 
@@ -15,6 +17,7 @@ namespace o2
 		mAnimation = state.mAnimation;
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 		player.relTime = mState ? 1.0f:0.0f;
+		player.onPlayEvent += THIS_FUNC(OnPlayerStarted);
 	}
 
 	WidgetState::~WidgetState()
@@ -35,6 +38,10 @@ namespace o2
 		mOwner = owner;
 		player.SetTarget(owner, errors);
 		player.relTime = mState ? 1.0f : 0.0f;
+
+		// Player could be started before owner was set
+		if (player.IsPlaying())
+			OnPlayerStarted();
 	}
 
 	void WidgetState::SetAnimationAsset(const AnimationAssetRef& asset)
@@ -139,6 +146,12 @@ namespace o2
 		}
 	}
 
+	void WidgetState::OnPlayerStarted()
+	{
+		if (mOwner)
+			mOwner->mHasActiveStates = true;
+	}
+
 	void WidgetState::OnAnimationChanged()
 	{
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
@@ -157,3 +170,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::WidgetState);
+CLASS_SERIALIZATION_META(o2::WidgetState)
+{
+	SERIALIZABLE_FIELD(name);
+	SERIALIZABLE_FIELD_DEFAULT(offStateAnimationSpeed, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mState, false);
+	SERIALIZABLE_FIELD(mAnimation);
+}
+END_META;
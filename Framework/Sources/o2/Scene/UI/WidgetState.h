@@ -89,6 +89,9 @@ namespace o2
 		AnimationAssetRef mAnimation; // Widget animation @SERIALIZABLE @EDITOR_PROPERTY @INVOKE_ON_CHANGE(OnAnimationChanged)
 
 	protected:
+		// It is called when player starts playing, owner widget updates states until animation is finished
+		void OnPlayerStarted();
+
 		// It is called when animation changed from editor
 		void OnAnimationChanged();
 
@@ -133,6 +136,7 @@ CLASS_METHODS_META(o2::WidgetState)
 	PUBLIC_FUNCTION(void, SetStateForcible, bool);
 	PUBLIC_FUNCTION(bool, GetState);
 	PUBLIC_FUNCTION(void, Update, float);
+	PROTECTED_FUNCTION(void, OnPlayerStarted);
 	PROTECTED_FUNCTION(void, OnAnimationChanged);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
@@ -189,3 +189,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Button);
+CLASS_SERIALIZATION_META(o2::Button)
+{
+}
+END_META;
@@ -953,7 +953,31 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ContextMenu);
+CLASS_SERIALIZATION_META(o2::ContextMenu)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mMaxVisibleItems, 100);
+	SERIALIZABLE_FIELD_DEFAULT(mItemSample, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSeparatorSample, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionDrawable, nullptr);
+	SERIALIZABLE_FIELD(mSelectionLayout);
+}
+END_META;
 
 DECLARE_CLASS(o2::ContextMenuItem);
+CLASS_SERIALIZATION_META(o2::ContextMenuItem)
+{
+}
+END_META;
 
 DECLARE_CLASS(o2::ContextMenu::Item);
+CLASS_SERIALIZATION_META(o2::ContextMenu::Item)
+{
+	SERIALIZABLE_FIELD(text);
+	SERIALIZABLE_FIELD(group);
+	SERIALIZABLE_FIELD(icon);
+	SERIALIZABLE_FIELD(subItems);
+	SERIALIZABLE_FIELD(checked);
+	SERIALIZABLE_FIELD(checkable);
+	SERIALIZABLE_FIELD(mShortcut);
+}
+END_META;
@@ -321,3 +321,10 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::CustomDropDown);
+CLASS_SERIALIZATION_META(o2::CustomDropDown)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mItemsList, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mClipLayout, Layout::BothStretch());
+	SERIALIZABLE_FIELD_DEFAULT(mMaxListItems, 10);
+}
+END_META;
@@ -166,3 +166,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::DropDown);
+CLASS_SERIALIZATION_META(o2::DropDown)
+{
+}
+END_META;
@@ -1322,3 +1322,17 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::EditBox);
+CLASS_SERIALIZATION_META(o2::EditBox)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionColor, Color4(0.1f, 0.2f, 0.6f, 0.3f));
+	SERIALIZABLE_FIELD(mText);
+	SERIALIZABLE_FIELD(mAvailableSymbols);
+	SERIALIZABLE_FIELD_DEFAULT(mTextDrawable, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mCaretDrawable, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mCaretBlinkDelay, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mMultiLine, true);
+	SERIALIZABLE_FIELD_DEFAULT(mWordWrap, false);
+	SERIALIZABLE_FIELD_DEFAULT(mMaxLineChars, INT_MAX);
+	SERIALIZABLE_FIELD_DEFAULT(mMaxLinesCount, INT_MAX);
+}
+END_META;
@@ -921,3 +921,14 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::GridLayout);
+CLASS_SERIALIZATION_META(o2::GridLayout)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mBaseCorner, BaseCorner::Left);
+	SERIALIZABLE_FIELD_DEFAULT(mSpacing, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mCellSize, Vec2F(50, 50));
+	SERIALIZABLE_FIELD_DEFAULT(mArrangeAxis, TwoDirection::Horizontal);
+	SERIALIZABLE_FIELD_DEFAULT(mArrangeAxisMaxCells, 5);
+	SERIALIZABLE_FIELD(mBorder);
+	SERIALIZABLE_FIELD_DEFAULT(mFitByChildren, false);
+}
+END_META;
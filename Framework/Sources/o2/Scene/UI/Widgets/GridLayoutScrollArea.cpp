@@ -282,3 +282,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::GridLayoutScrollArea);
+CLASS_SERIALIZATION_META(o2::GridLayoutScrollArea)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mItemSample, nullptr);
+	SERIALIZABLE_FIELD(mItemsSpacing);
+}
+END_META;
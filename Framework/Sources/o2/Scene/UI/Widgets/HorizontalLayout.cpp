@@ -191,7 +191,7 @@ namespace o2
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetMinWidthWithChildren();
+				res += child->GetCachedMinWidthWithChildren();
 		}
 
 		res = Math::Max(res, GetLayoutData().minSize.x);
@@ -208,7 +208,7 @@ namespace o2
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res = Math::Max(res, child->GetMinHeightWithChildren() + mBorder.top + mBorder.bottom);
+				res = Math::Max(res, child->GetCachedMinHeightWithChildren() + mBorder.top + mBorder.bottom);
 		}
 
 		res = Math::Max(res, GetLayoutData().minSize.y);
@@ -306,7 +306,7 @@ namespace o2
 		}
 		else
 		{
-			float totalWidth = mChildWidgets.Sum<float>([&](Widget* child) { return child->GetMinWidthWithChildren(); });
+			float totalWidth = mChildWidgets.Sum<float>([&](Widget* child) { return child->GetCachedMinWidthWithChildren(); });
 			totalWidth += (mChildWidgets.Count() - 1)*mSpacing;
 			float position = -totalWidth*0.5f;
 			for (auto child : mChildWidgets)
@@ -315,7 +315,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMin.x = position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetMinWidthWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetCachedMinWidthWithChildren()));
 
 				child->GetLayoutData().offsetMax.x = position;
 				position += mSpacing;
@@ -355,7 +355,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMin.x = position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetMinWidthWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetCachedMinWidthWithChildren()));
 
 				child->GetLayoutData().offsetMax.x = position;
 				position += mSpacing;
@@ -395,7 +395,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMax.x = -position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetMinWidthWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.x, child->GetCachedMinWidthWithChildren()));
 
 				child->GetLayoutData().offsetMin.x = -position;
 				position += mSpacing;
@@ -456,7 +456,7 @@ namespace o2
 		};
 
 		Vec2F relativePivot = relativePivots[(int)mBaseCorner];
-		Vec2F size(GetMinWidthWithChildren(), GetMinHeightWithChildren());
+		Vec2F size(GetCachedMinWidthWithChildren(), GetCachedMinHeightWithChildren());
 
 		Vec2F parentSize = mParent ? mParent->transform->size : Vec2F();
 		Vec2F szDelta = size - (GetLayoutData().offsetMax - GetLayoutData().offsetMin + (GetLayoutData().anchorMax - GetLayoutData().anchorMin)*parentSize);
@@ -473,3 +473,13 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::HorizontalLayout);
+CLASS_SERIALIZATION_META(o2::HorizontalLayout)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mBaseCorner, BaseCorner::Left);
+	SERIALIZABLE_FIELD_DEFAULT(mSpacing, 0.0f);
+	SERIALIZABLE_FIELD(mBorder);
+	SERIALIZABLE_FIELD_DEFAULT(mExpandWidth, true);
+	SERIALIZABLE_FIELD_DEFAULT(mExpandHeight, true);
+	SERIALIZABLE_FIELD_DEFAULT(mFitByChildren, false);
+}
+END_META;
@@ -94,3 +94,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Image);
+CLASS_SERIALIZATION_META(o2::Image)
+{
+}
+END_META;
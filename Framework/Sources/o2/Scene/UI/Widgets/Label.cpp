@@ -268,7 +268,11 @@ namespace o2
 				float realSize = mTextDrawable->GetRealSize().x + mExpandBorder.x*2.0f;
 				float thisSize = layout->width;
 				float sizeDelta = realSize - thisSize;
-				GetLayoutData().minSize.x = realSize;
+				if (!Math::Equals(GetLayoutData().minSize.x, realSize))
+				{
+					GetLayoutData().minSize.x = realSize;
+					InvalidateMinSizeCache();
+				}
 
 				switch (mTextDrawable->GetHorAlign())
 				{
@@ -379,3 +383,10 @@ ENUM_META(o2::Label::VerOverflow)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::Label);
+CLASS_SERIALIZATION_META(o2::Label)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mHorOverflow, HorOverflow::None);
+	SERIALIZABLE_FIELD_DEFAULT(mVerOverflow, VerOverflow::None);
+	SERIALIZABLE_FIELD(mExpandBorder);
+}
+END_META;
@@ -133,3 +133,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::List);
+CLASS_SERIALIZATION_META(o2::List)
+{
+}
+END_META;
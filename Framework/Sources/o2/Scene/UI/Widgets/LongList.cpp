@@ -521,3 +521,12 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::LongList);
+CLASS_SERIALIZATION_META(o2::LongList)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mItemSample, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionDrawable, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mHoverDrawable, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionLayout, Layout::BothStretch());
+	SERIALIZABLE_FIELD_DEFAULT(mHoverLayout, Layout::BothStretch());
+}
+END_META;
@@ -508,5 +508,18 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::MenuPanel);
+CLASS_SERIALIZATION_META(o2::MenuPanel)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mItemSample, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectionDrawable, nullptr);
+	SERIALIZABLE_FIELD(mSelectionLayout);
+}
+END_META;
 
 DECLARE_CLASS(o2::MenuPanel::Item);
+CLASS_SERIALIZATION_META(o2::MenuPanel::Item)
+{
+	SERIALIZABLE_FIELD(text);
+	SERIALIZABLE_FIELD(subItems);
+}
+END_META;
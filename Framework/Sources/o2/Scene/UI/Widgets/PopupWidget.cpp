@@ -174,8 +174,8 @@ namespace o2
 
 		for (auto child : mChildWidgets)
 		{
-			size.x = Math::Max(size.x, child->GetMinWidthWithChildren());
-			size.y = Math::Max(size.y, child->GetMinHeightWithChildren());
+			size.x = Math::Max(size.x, child->GetCachedMinWidthWithChildren());
+			size.y = Math::Max(size.y, child->GetCachedMinHeightWithChildren());
 		}
 
 		size.x += mViewAreaLayout.offsetMin.x - mViewAreaLayout.offsetMax.x;
@@ -253,3 +253,9 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::PopupWidget);
+CLASS_SERIALIZATION_META(o2::PopupWidget)
+{
+	SERIALIZABLE_FIELD_DEFAULT(fitByChildren, true);
+	SERIALIZABLE_FIELD_DEFAULT(mFitSizeMin, 40.0f);
+}
+END_META;
@@ -755,3 +755,13 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ScrollArea);
+CLASS_SERIALIZATION_META(o2::ScrollArea)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mViewAreaLayout, Layout::BothStretch());
+	SERIALIZABLE_FIELD_DEFAULT(mClipAreaLayout, Layout::BothStretch());
+	SERIALIZABLE_FIELD(mScrollPos);
+	SERIALIZABLE_FIELD_DEFAULT(mScrollSpeedDamp, 7.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mEnableScrollsHiding, true);
+	SERIALIZABLE_FIELD_DEFAULT(mShowScrollBarsByCursor, false);
+}
+END_META;
@@ -128,6 +128,7 @@ namespace o2
 	void Spoiler::SetHeadHeight(float height)
 	{
 		mHeadHeight = height;
+		SetLayoutDirty();
 	}
 
 	float Spoiler::GetHeadHeight() const
@@ -183,7 +184,7 @@ namespace o2
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetMinHeightWithChildren();
+				res += child->GetCachedMinHeightWithChildren();
 		}
 
 		res = res*Math::Clamp01(mExpandCoef) + mHeadHeight;
@@ -199,7 +200,12 @@ namespace o2
 		else
 		{
 			GetLayoutData().weight.y = 1;
-			GetLayoutData().minSize.y = 0;
+
+			if (GetLayoutData().minSize.y != 0)
+			{
+				GetLayoutData().minSize.y = 0;
+				InvalidateMinSizeCache();
+			}
 		}
 	}
 
@@ -245,3 +251,8 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Spoiler);
+CLASS_SERIALIZATION_META(o2::Spoiler)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mHeadHeight, 0.0f);
+}
+END_META;
@@ -393,3 +393,9 @@ ENUM_META(o2::ToggleGroup::Type)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::Toggle);
+CLASS_SERIALIZATION_META(o2::Toggle)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mValue, false);
+	SERIALIZABLE_FIELD_DEFAULT(mValueUnknown, false);
+}
+END_META;
@@ -347,7 +347,7 @@ namespace o2
 		if (mHighlightAnim.IsPlaying())
 		{
 			if (mHighlightObject && !mHighlighNode)
-				mHighlighNode = mAllNodes.FindOrDefault([=](Node* x) { return x->object == mHighlightObject; });
+				mHighlighNode = FindNode(mHighlightObject);
 
 			if (mHighlighNode && mHighlighNode->widget)
 			{
@@ -461,7 +461,7 @@ namespace o2
 
 			uiNode->mIsSelected = true;
 
-			Node* node = mAllNodes.FindOrDefault([=](Node* x) { return x->widget == uiNode; });
+			Node* node = uiNode->mNodeDef;
 			node->SetSelected(true);
 			mSelectedNodes.Add(node);
 			mSelectedObjects.Add(node->object);
@@ -605,7 +605,7 @@ namespace o2
 
 	TreeNode* Tree::GetNode(void* object)
 	{
-		Node* fnd = mAllNodes.FindOrDefault([=](Node* x) { return x->object == object; });
+		Node* fnd = FindNode(object);
 		if (fnd)
 			return fnd->widget;
 
@@ -658,7 +658,7 @@ namespace o2
 
 		for (auto obj : objects)
 		{
-			auto node = mAllNodes.FindOrDefault([=](Node* x) { return x->object == obj; });
+			auto node = FindNode(obj);
 
 			if (!node)
 				continue;
@@ -684,7 +684,7 @@ namespace o2
 			return;
 		}
 
-		auto node = mAllNodes.FindOrDefault([=](Node* x) { return x->object == object; });
+		auto node = FindNode(object);
 		if (!node)
 			return;
 
@@ -739,7 +739,8 @@ namespace o2
 
 		ExpandParentObjects(object);
 
-		int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
+		Node* node = FindNode(object);
+		int idx = node ? GetNodePosition(node) : -1;
 
 		if (idx >= 0)
 			SetScroll(Vec2F(mScrollPos.x, (float)idx*mNodeWidgetSample->layout->minHeight - layout->height*0.5f));
@@ -755,7 +756,8 @@ namespace o2
 
 		ExpandParentObjects(object);
 
-		int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
+		Node* node = FindNode(object);
+		int idx = node ? GetNodePosition(node) : -1;
 
 		if (idx >= 0)
 		{
@@ -781,7 +783,7 @@ namespace o2
 
 		for (int i = parentsStack.Count() - 1; i >= 0; i--)
 		{
-			auto node = mAllNodes.FindOrDefault([&](Node* x) { return x->object == parentsStack[i]; });
+			auto node = FindNode(parentsStack[i]);
 
 			if (!node)
 			{
@@ -853,7 +855,7 @@ namespace o2
 			VisibleWidgetDef cache;
 			cache.object = node->object;
 			cache.widget = node->widget;
-			cache.position = mAllNodes.IndexOf(node);
+			cache.position = GetNodePosition(node);
 
 			mVisibleWidgetsCache.Add(cache);
 		}
@@ -861,6 +863,8 @@ namespace o2
 		mNodesBuf.Add(mAllNodes);
 
 		mAllNodes.Clear();
+		mObjectsNodes.clear();
+		mNodesPositionsDirty = false;
 		mVisibleNodes.Clear();
 		mChildren.Clear();
 		mChildWidgets.Clear();
@@ -876,6 +880,7 @@ namespace o2
 				continue;
 
 			Node* node = CreateNode(object, nullptr);
+			node->position = position;
 			mAllNodes.Insert(node, position++);
 			position += InsertNodes(node, position);
 		}
@@ -887,7 +892,7 @@ namespace o2
 	{
 		int initialPosition = position;
 
-		if (mExpandedObjects.Contains(parentNode->object))
+		if (mExpandedObjects.count(parentNode->object) > 0)
 		{
 			auto childObjects = GetObjectChilds(parentNode->object);
 			for (auto child : childObjects)
@@ -897,6 +902,12 @@ namespace o2
 
 				Node* node = CreateNode(child, parentNode);
 
+				// Nodes are appended when building whole structure, otherwise following positions are shifted
+				if (position == mAllNodes.Count())
+					node->position = position;
+				else
+					mNodesPositionsDirty = true;
+
 				mAllNodes.Insert(node, position++);
 
 				if (newNodes)
@@ -911,10 +922,10 @@ namespace o2
 
 	void Tree::RemoveNodes(Node* parentNode)
 	{
-		int begin = mAllNodes.IndexOf(parentNode) + 1;
+		int begin = GetNodePosition(parentNode) + 1;
 		int end = begin - 1 + parentNode->GetChildCount();
 
-		mAllNodes.RemoveRange(begin, end);
+		RemoveNodesRange(begin, end);
 	}
 
 	Tree::Node* Tree::CreateNode(void* object, Node* parent)
@@ -926,7 +937,8 @@ namespace o2
 		node->object = object;
 		node->widget = nullptr;
 		node->isSelected = mSelectedObjects.Contains(object);
-		node->isExpanded = mExpandedObjects.Contains(object);
+		node->isExpanded = mExpandedObjects.count(object) > 0;
+		node->position = -1;
 		node->level = parent ? parent->level + 1 : 0;
 
 		node->id = GetObjectDebug(object);
@@ -937,9 +949,46 @@ namespace o2
 		if (node->isSelected)
 			mSelectedNodes.Add(node);
 
+		mObjectsNodes[object] = node;
+
 		return node;
 	}
 
+	Tree::Node* Tree::FindNode(void* object) const
+	{
+		auto fnd = mObjectsNodes.find(object);
+		if (fnd != mObjectsNodes.end())
+			return fnd->second;
+
+		return nullptr;
+	}
+
+	int Tree::GetNodePosition(Node* node)
+	{
+		if (mNodesPositionsDirty)
+		{
+			for (int i = 0; i < mAllNodes.Count(); i++)
+				mAllNodes[i]->position = i;
+
+			mNodesPositionsDirty = false;
+		}
+
+		return node->position;
+	}
+
+	void Tree::RemoveNodesRange(int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			auto fnd = mObjectsNodes.find(mAllNodes[i]->object);
+			if (fnd != mObjectsNodes.end() && fnd->second == mAllNodes[i])
+				mObjectsNodes.erase(fnd);
+		}
+
+		mAllNodes.RemoveRange(begin, end);
+		mNodesPositionsDirty = true;
+	}
+
 	void Tree::CopyData(const Actor& otherActor)
 	{
 		const Tree& other = dynamic_cast<const Tree&>(otherActor);
@@ -1197,12 +1246,12 @@ namespace o2
 
 	void Tree::ExpandNode(Node* node)
 	{
-		int position = mAllNodes.IndexOf(node) + 1;
+		int position = GetNodePosition(node) + 1;
 
 		if (mExpandingNodeState != ExpandState::None && mExpandingNodeIdx != position - 1)
 			UpdateNodeExpanding(mExpandNodeTime);
 
-		mExpandedObjects.Add(node->object);
+		mExpandedObjects.insert(node->object);
 
 		node->isExpanded = true;
 
@@ -1260,12 +1309,12 @@ namespace o2
 
 	void Tree::CollapseNode(Node* node)
 	{
-		int idx = mAllNodes.IndexOf(node);
+		int idx = GetNodePosition(node);
 
 		if (mExpandingNodeState != ExpandState::None && mExpandingNodeIdx != idx)
 			UpdateNodeExpanding(mExpandNodeTime);
 
-		mExpandedObjects.Remove(node->object);
+		mExpandedObjects.erase(node->object);
 
 		node->isExpanded = false;
 
@@ -1281,7 +1330,7 @@ namespace o2
 
 	void Tree::StartExpandingAnimation(ExpandState direction, Node* node, int childrenCount)
 	{
-		int idx = mAllNodes.IndexOf(node);
+		int idx = GetNodePosition(node);
 
 		float nodeHeight = mNodeWidgetSample->layout->GetMinHeight();
 
@@ -1346,7 +1395,7 @@ namespace o2
 						mSelectedNodes.Remove(node);
 				}
 
-				mAllNodes.RemoveRange(mExpandingNodeIdx + 1, mExpandingNodeIdx + mExpandingNodeChildsCount + 1);
+				RemoveNodesRange(mExpandingNodeIdx + 1, mExpandingNodeIdx + mExpandingNodeChildsCount + 1);
 				mExpandingNodeChildsCount = 0;
 			}
 		}
@@ -1630,7 +1679,7 @@ namespace o2
 
 			if (node->widget && changed)
 			{
-				UpdateNodeWidgetLayout(node, mAllNodes.IndexOf(node));
+				UpdateNodeWidgetLayout(node, GetNodePosition(node));
 				node->widget->SetLayoutDirty();
 			}
 		}
@@ -1947,5 +1996,25 @@ ENUM_META(o2::Tree::ExpandState)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::Tree);
+CLASS_SERIALIZATION_META(o2::Tree)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mRearrangeType, RearrangeType::Enabled);
+	SERIALIZABLE_FIELD_DEFAULT(mMultiSelectAvailable, true);
+	SERIALIZABLE_FIELD_DEFAULT(mNodeWidgetSample, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mChildrenOffset, 10.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mHoverDrawable, nullptr);
+	SERIALIZABLE_FIELD(mHoverLayout);
+	SERIALIZABLE_FIELD_DEFAULT(mNodeExpandTime, 2.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mNodeDragIntoZone, 0.3f);
+	SERIALIZABLE_FIELD(mHighlightAnim);
+	SERIALIZABLE_FIELD_DEFAULT(mHighlightSprite, nullptr);
+	SERIALIZABLE_FIELD(mHighlightLayout);
+	SERIALIZABLE_FIELD_DEFAULT(mZebraBackLine, nullptr);
+}
+END_META;
 
 DECLARE_CLASS(o2::TreeNode);
+CLASS_SERIALIZATION_META(o2::TreeNode)
+{
+}
+END_META;
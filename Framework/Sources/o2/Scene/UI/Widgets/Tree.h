@@ -4,6 +4,8 @@
 #include "o2/Scene/UI/Widgets/VerticalLayout.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
 #include "o2/Utils/Math/Curve.h"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace o2
 {
@@ -199,6 +201,7 @@ namespace o2
 			int        level = 0;          // Hierarchy depth level
 			bool       isSelected = false; // Is node selected
 			bool       isExpanded = false; // Is node expanded
+			int        position = -1;      // Position in all nodes list. Actual when positions aren't dirty
 
 			Node*         parent = nullptr; // Parent node definition
 			Vector<Node*> childs;           // Children nodes definitions
@@ -243,7 +246,9 @@ namespace o2
 		bool mIsNeedUdateLayout = false;        // Is layout needs to rebuild
 		bool mIsNeedUpdateVisibleNodes = false; // In need to update visible nodes
 
-		Vector<Node*> mAllNodes; // All expanded nodes definitions
+		Vector<Node*>                    mAllNodes;                    // All expanded nodes definitions
+		std::unordered_map<void*, Node*> mObjectsNodes;                // All expanded nodes definitions by objects
+		bool                             mNodesPositionsDirty = false; // Is nodes positions changed and needs to be recalculated
 
 		Vector<void*> mSelectedObjects; // Selected objects
 		Vector<Node*> mSelectedNodes;   // Selected nodes definitions
@@ -270,7 +275,7 @@ namespace o2
 		Vector<void*> mBeforeDragSelectedItems;       // Before drag begin selection
 		bool          mDragEnded = false;             // Is dragging ended and it needs to call EndDragging
 
-		Vector<void*> mExpandedObjects; // Expanded objects
+		std::unordered_set<void*> mExpandedObjects; // Expanded objects
 
 		ExpandState mExpandingNodeState = ExpandState::None; // Expanding node state
 		int         mExpandingNodeIdx = -1;                  // Current expanding node index. -1 if no expanding node
@@ -395,6 +400,15 @@ namespace o2
 		// Creates node from object with parent
 		Node* CreateNode(void* object, Node* parent);
 
+		// Returns node by object, nullptr if object isn't in expanded nodes
+		Node* FindNode(void* object) const;
+
+		// Returns node position in all nodes list. Recalculates positions if they are dirty
+		int GetNodePosition(Node* node);
+
+		// Removes nodes in range [begin, end) from all nodes list and objects index
+		void RemoveNodesRange(int begin, int end);
+
 		// Updates visible nodes (calculates range and initializes nodes)
 		virtual void UpdateVisibleNodes();
 
@@ -617,6 +631,8 @@ CLASS_FIELDS_META(o2::Tree)
 	PROTECTED_FIELD(mIsNeedUdateLayout).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mIsNeedUpdateVisibleNodes).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mAllNodes);
+	PROTECTED_FIELD(mObjectsNodes);
+	PROTECTED_FIELD(mNodesPositionsDirty).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mSelectedObjects);
 	PROTECTED_FIELD(mSelectedNodes);
 	PROTECTED_FIELD(mNodeWidgetsBuf);
@@ -738,6 +754,9 @@ CLASS_METHODS_META(o2::Tree)
 	PROTECTED_FUNCTION(int, InsertNodes, Node*, int, Vector<Node*>*);
 	PROTECTED_FUNCTION(void, RemoveNodes, Node*);
 	PROTECTED_FUNCTION(Node*, CreateNode, void*, Node*);
+	PROTECTED_FUNCTION(Node*, FindNode, void*);
+	PROTECTED_FUNCTION(int, GetNodePosition, Node*);
+	PROTECTED_FUNCTION(void, RemoveNodesRange, int, int);
 	PROTECTED_FUNCTION(void, UpdateVisibleNodes);
 	PROTECTED_FUNCTION(void, CreateVisibleNodeWidget, Node*, int);
 	PROTECTED_FUNCTION(void, UpdateNodeView, Node*, TreeNode*, int);
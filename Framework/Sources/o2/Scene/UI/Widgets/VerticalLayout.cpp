@@ -193,7 +193,7 @@ namespace o2
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res = Math::Max(res, child->GetMinWidthWithChildren() + mBorder.left + mBorder.right);
+				res = Math::Max(res, child->GetCachedMinWidthWithChildren() + mBorder.left + mBorder.right);
 		}
 
 		res = Math::Max(res, GetLayoutData().minSize.x);
@@ -210,7 +210,7 @@ namespace o2
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetMinHeightWithChildren();
+				res += child->GetCachedMinHeightWithChildren();
 		}
 
 		res = Math::Max(res, GetLayoutData().minSize.y);
@@ -305,7 +305,7 @@ namespace o2
 		}
 		else
 		{
-			float totalHeight = mChildWidgets.Sum<float>([&](Widget* child) { return child->GetMinHeightWithChildren(); });
+			float totalHeight = mChildWidgets.Sum<float>([&](Widget* child) { return child->GetCachedMinHeightWithChildren(); });
 			totalHeight += (mChildWidgets.Count() - 1)*mSpacing;
 			float position = -totalHeight*0.5f;
 			for (auto child : mChildWidgets)
@@ -314,7 +314,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMin.y = position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetMinHeightWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetCachedMinHeightWithChildren()));
 
 				child->GetLayoutData().offsetMax.y = position;
 				position += mSpacing;
@@ -357,7 +357,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMin.y = position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetMinHeightWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetCachedMinHeightWithChildren()));
 
 				child->GetLayoutData().offsetMax.y = position;
 				position += mSpacing;
@@ -400,7 +400,7 @@ namespace o2
 					continue;
 
 				child->GetLayoutData().offsetMax.y = -position;
-				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetMinHeightWithChildren()));
+				position += Math::Abs(Math::Max(child->GetLayoutData().minSize.y, child->GetCachedMinHeightWithChildren()));
 
 				child->GetLayoutData().offsetMin.y = -position;
 				position += mSpacing;
@@ -461,7 +461,7 @@ namespace o2
 		};
 
 		Vec2F relativePivot = relativePivots[(int)mBaseCorner];
-		Vec2F size(GetMinWidthWithChildren(), GetMinHeightWithChildren());
+		Vec2F size(GetCachedMinWidthWithChildren(), GetCachedMinHeightWithChildren());
 
 		Vec2F parentSize = mParentWidget ? mParentWidget->GetChildrenWorldRect().Size() : Vec2F();
 		Vec2F szDelta = size - (GetLayoutData().offsetMax - GetLayoutData().offsetMin + (GetLayoutData().anchorMax - GetLayoutData().anchorMin)*parentSize);
@@ -478,3 +478,13 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::VerticalLayout);
+CLASS_SERIALIZATION_META(o2::VerticalLayout)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mBaseCorner, BaseCorner::Top);
+	SERIALIZABLE_FIELD_DEFAULT(mSpacing, 0.0f);
+	SERIALIZABLE_FIELD(mBorder);
+	SERIALIZABLE_FIELD_DEFAULT(mExpandWidth, true);
+	SERIALIZABLE_FIELD_DEFAULT(mExpandHeight, true);
+	SERIALIZABLE_FIELD_DEFAULT(mFitByChildren, false);
+}
+END_META;
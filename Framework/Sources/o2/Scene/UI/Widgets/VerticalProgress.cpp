@@ -293,3 +293,12 @@ ENUM_META(o2::VerticalProgress::Orientation)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::VerticalProgress);
+CLASS_SERIALIZATION_META(o2::VerticalProgress)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mValue, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mMinValue, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mMaxValue, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mScrollSense, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mOrientation, Orientation::Down);
+}
+END_META;
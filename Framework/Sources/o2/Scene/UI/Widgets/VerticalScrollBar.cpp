@@ -358,3 +358,13 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::VerticalScrollBar);
+CLASS_SERIALIZATION_META(o2::VerticalScrollBar)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mValue, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mMinValue, 0.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mMaxValue, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mScrollSense, 1.0f);
+	SERIALIZABLE_FIELD_DEFAULT(mScrollHandleSize, 0.2f);
+	SERIALIZABLE_FIELD_DEFAULT(mScrollhandleMinPxSize, 5.0f);
+}
+END_META;
@@ -398,3 +398,16 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Window);
+CLASS_SERIALIZATION_META(o2::Window)
+{
+	SERIALIZABLE_FIELD(mHeadDragAreaLayout);
+	SERIALIZABLE_FIELD(mTopDragAreaLayout);
+	SERIALIZABLE_FIELD(mBottomDragAreaLayout);
+	SERIALIZABLE_FIELD(mLeftDragAreaLayout);
+	SERIALIZABLE_FIELD(mRightDragAreaLayout);
+	SERIALIZABLE_FIELD(mLeftTopDragAreaLayout);
+	SERIALIZABLE_FIELD(mRightTopDragAreaLayout);
+	SERIALIZABLE_FIELD(mLeftBottomDragAreaLayout);
+	SERIALIZABLE_FIELD(mRightBottomDragAreaLayout);
+}
+END_META;
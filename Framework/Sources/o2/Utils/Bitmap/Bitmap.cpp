@@ -4,6 +4,7 @@
 #include "o2/Utils/Bitmap/PngFormat.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/Tasks/ThreadPool.h"
 
 namespace o2
 {
@@ -279,136 +280,229 @@ namespace o2
 
 	void Bitmap::Blur(float radius)
 	{
-		int mapSize = Math::CeilToInt(radius);
-		int fullmapSize = mapSize * 2 + 1;
+		if (radius <= 0.0f || mSize.x <= 0 || mSize.y <= 0)
+			return;
 
-		float** weightMap = mnew float*[fullmapSize];
-		for (int i = 0; i < fullmapSize; i++)
-		{
-			weightMap[i] = mnew float[fullmapSize];
+		int kernelRadius = Math::CeilToInt(radius);
+		int kernelSize = kernelRadius*2 + 1;
 
-			for (int j = 0; j < fullmapSize; j++)
-			{
-				float x = (float)(i - mapSize), y = (float)(j - mapSize);
-				float dst = Math::Sqrt(x*x + y*y);
-				weightMap[i][j] = Math::Clamp01(1.0f - dst / radius);
-			}
+		// Separable gaussian with same variance as radial weights (1 - distance/radius)
+		float sigma = radius*0.387f;
+		float* kernel = mnew float[kernelSize];
+		for (int i = 0; i < kernelSize; i++)
+		{
+			float x = (float)(i - kernelRadius);
+			kernel[i] = std::exp(-x*x/(2.0f*sigma*sigma));
 		}
 
 		int bpp[] = { 4, 3 };
 		int curbpp = bpp[(int)mFormat];
-		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
-		memcpy(srcData, mData, mSize.x*mSize.y*curbpp);
+		int rowSize = mSize.x*curbpp;
 
-		for (int x = 0; x < mSize.x; x++)
+		// Inverted sums of kernel weights inside image for each position, normalizes edges
+		auto getNormalizeFactors = [&](int size)
 		{
-			for (int y = 0; y < mSize.y; y++)
+			float* factors = mnew float[size];
+			for (int i = 0; i < size; i++)
 			{
-				Color4 c;
-				Color4 csum(0, 0, 0, 0);
-				float wSum = 0;
+				float sum = 0.0f;
+				for (int k = Math::Max(-kernelRadius, -i); k <= Math::Min(kernelRadius, size - 1 - i); k++)
+					sum += kernel[k + kernelRadius];
 
-				for (int ox = 0; ox < fullmapSize; ox++)
+				factors[i] = 1.0f/sum;
+			}
+
+			return factors;
+		};
+
+		float* columnsFactors = getNormalizeFactors(mSize.x);
+		float* rowsFactors = getNormalizeFactors(mSize.y);
+		float* buffer = mnew float[rowSize*mSize.y];
+
+		// Horizontal pass, from data to buffer
+		o2ThreadPool.ParallelForRanges(mSize.y, 16, [&](int begin, int end) {
+			float* srcRow = mnew float[rowSize];
+
+			for (int y = begin; y < end; y++)
+			{
+				const UInt8* src = mData + y*rowSize;
+				float* dst = buffer + y*rowSize;
+
+				for (int i = 0; i < rowSize; i++)
 				{
-					for (int oy = 0; oy < fullmapSize; oy++)
-					{
-						int cx = x + (ox - mapSize), cy = y + (oy - mapSize);
+					srcRow[i] = (float)src[i];
+					dst[i] = 0.0f;
+				}
 
-						if (cx < 0 || cx >= mSize.x || cy < 0 || cy >= mSize.y)
-							continue;
+				for (int k = -kernelRadius; k <= kernelRadius; k++)
+				{
+					float weight = kernel[k + kernelRadius];
+					int from = Math::Max(0, -k)*curbpp, to = (mSize.x - Math::Max(0, k))*curbpp;
+					const float* shiftedSrc = srcRow + k*curbpp;
 
-						c.SetARGB(*(ULong*)&srcData[(cy*mSize.x + cx)*curbpp]);
-						float w = weightMap[ox][oy];
-						csum += c*w;
-						wSum += w;
-					}
+					for (int i = from; i < to; i++)
+						dst[i] += weight*shiftedSrc[i];
 				}
 
-				csum /= wSum;
-				ULong ucsum = csum.ARGB();
-				memcpy(&mData[(y*mSize.x + x)*curbpp], &ucsum, curbpp);
+				for (int x = 0, i = 0; x < mSize.x; x++)
+				{
+					for (int c = 0; c < curbpp; c++, i++)
+						dst[i] *= columnsFactors[x];
+				}
 			}
-		}
 
-		for (int i = 0; i < fullmapSize; i++)
-			delete[] weightMap[i];
+			delete[] srcRow;
+		});
 
-		delete[] weightMap;
-		delete[] srcData;
+		// Vertical pass, from buffer to data
+		o2ThreadPool.ParallelForRanges(mSize.y, 16, [&](int begin, int end) {
+			float* sum = mnew float[rowSize];
+
+			for (int y = begin; y < end; y++)
+			{
+				for (int i = 0; i < rowSize; i++)
+					sum[i] = 0.0f;
+
+				for (int k = Math::Max(-kernelRadius, -y); k <= Math::Min(kernelRadius, mSize.y - 1 - y); k++)
+				{
+					float weight = kernel[k + kernelRadius];
+					const float* src = buffer + (y + k)*rowSize;
+
+					for (int i = 0; i < rowSize; i++)
+						sum[i] += weight*src[i];
+				}
+
+				UInt8* dst = mData + y*rowSize;
+				float factor = rowsFactors[y];
+
+				for (int i = 0; i < rowSize; i++)
+					dst[i] = (UInt8)Math::Min(sum[i]*factor + 0.5f, 255.0f);
+			}
+
+			delete[] sum;
+		});
+
+		delete[] kernel;
+		delete[] columnsFactors;
+		delete[] rowsFactors;
+		delete[] buffer;
 	}
 
 	void Bitmap::Outline(float radius, const Color4& color, int threshold /*= 100*/)
 	{
-		int mapSize = Math::CeilToInt(radius);
-		int fullmapSize = mapSize * 2 + 1;
-		int alphaThreshold = threshold;
-		int radiusSquare = Math::Sqr(Math::FloorToInt(radius));
+		if (mSize.x <= 0 || mSize.y <= 0)
+			return;
 
 		int bpp[] = { 4, 3 };
 		int curbpp = bpp[(int)mFormat];
+		int rowSize = mSize.x*curbpp;
 
-		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
-		memcpy(srcData, mData, mSize.x*mSize.y*curbpp);
+		// Squared distances to nearest opaque pixel. Infinity is greater than any distance inside image
+		float* distances = mnew float[mSize.x*mSize.y];
+		float infinity = Math::Sqr((float)(mSize.x + mSize.y));
 
-		for (int x = 0; x < mSize.x; x++)
-		{
-			for (int y = 0; y < mSize.y; y++)
+		// Horizontal pass: distances to nearest opaque pixel in same row
+		o2ThreadPool.ParallelForRanges(mSize.y, 16, [&](int begin, int end) {
+			for (int y = begin; y < end; y++)
 			{
-				float sqrDist = 0;
-				int count = 0;
-				Color4 pc;
-				UInt offs = (y*mSize.x + x)*curbpp;
-				pc.SetABGR(*(ULong*)&srcData[offs]);
+				const UInt8* src = mData + y*rowSize;
+				float* dst = distances + y*mSize.x;
 
-				for (int ox = 0; ox < fullmapSize; ox++)
+				int lastOpaque = -1;
+				for (int x = 0; x < mSize.x; x++)
 				{
-					for (int oy = 0; oy < fullmapSize; oy++)
-					{
-						int fx = ox - mapSize, fy = oy - mapSize;
-						int cx = x + (ox - mapSize), cy = y + (oy - mapSize);
-
-						if (cx < 0 || cx >= mSize.x || cy < 0 || cy >= mSize.y)
-							continue;
-
-						Color4 c;
-						c.SetABGR(*(ULong*)&srcData[(cy*mSize.x + cx)*curbpp]);
-						if (c.a > alphaThreshold)
-						{
-							int dst = fx*fx + fy*fy;
-							sqrDist += dst;
-							count++;
-						}
-					}
-				}
+					int alpha = curbpp == 4 ? src[x*curbpp + 3] : 255;
+					if (alpha > threshold)
+						lastOpaque = x;
 
-				sqrDist /= (float)count;
+					dst[x] = lastOpaque >= 0 ? (float)(x - lastOpaque) : infinity;
+				}
 
-				if (sqrDist < radiusSquare - 2 && false)
+				lastOpaque = -1;
+				for (int x = mSize.x - 1; x >= 0; x--)
 				{
-					Color4 newColor = pc.BlendByAlpha(color);
-					ULong unewColor = newColor.ABGR();
-					memcpy(&mData[offs], &unewColor, curbpp);
+					if (dst[x] == 0.0f)
+						lastOpaque = x;
 
+					if (lastOpaque >= 0)
+						dst[x] = Math::Min(dst[x], (float)(lastOpaque - x));
+
+					if (dst[x] < infinity)
+						dst[x] *= dst[x];
 				}
-				else
-				{
-					float distance = Math::Sqrt((float)sqrDist);
+			}
+		});
+
+		// Vertical pass: lower envelope of parabolas by columns, gives squared euclidean distances
+		o2ThreadPool.ParallelForRanges(mSize.x, 16, [&](int begin, int end) {
+			int size = mSize.y;
+			float* f = mnew float[size];
+			float* z = mnew float[size + 1];
+			int* v = mnew int[size];
+
+			for (int x = begin; x < end; x++)
+			{
+				for (int y = 0; y < size; y++)
+					f[y] = distances[y*mSize.x + x];
+
+				int k = 0;
+				v[0] = 0;
+				z[0] = -infinity;
+				z[1] = infinity;
 
-					if (distance < radius + 1.0f)
+				for (int q = 1; q < size; q++)
+				{
+					float s;
+					while (true)
 					{
-						float alpha = 1.0f - (distance - radius);
+						s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+						if (s > z[k] || k == 0)
+							break;
 
-						Color4 newColor = color;
-						newColor.a = (int)((float)newColor.a*alpha);
-						newColor = pc.BlendByAlpha(color);
-						ULong unewColor = newColor.ABGR();
-						memcpy(&mData[offs], &unewColor, curbpp);
+						k--;
 					}
+
+					k++;
+					v[k] = q;
+					z[k] = s;
+					z[k + 1] = infinity;
+				}
+
+				k = 0;
+				for (int q = 0; q < size; q++)
+				{
+					while (z[k + 1] < (float)q)
+						k++;
+
+					distances[q*mSize.x + x] = Math::Sqr((float)(q - v[k])) + f[v[k]];
 				}
 			}
-		}
 
-		delete[] srcData;
+			delete[] f;
+			delete[] z;
+			delete[] v;
+		});
+
+		// Blends outline color under pixels closer than radius + 1 to opaque pixels
+		float maxSqrDistance = Math::Sqr(radius + 1.0f);
+		o2ThreadPool.ParallelForRanges(mSize.y, 16, [&](int begin, int end) {
+			for (int y = begin; y < end; y++)
+			{
+				for (int x = 0; x < mSize.x; x++)
+				{
+					float sqrDistance = distances[y*mSize.x + x];
+					if (sqrDistance >= infinity || sqrDistance >= maxSqrDistance)
+						continue;
+
+					UInt8* pixel = mData + y*rowSize + x*curbpp;
+					Color4 pc(pixel[0], pixel[1], pixel[2], curbpp == 4 ? pixel[3] : 255);
+					ULong newColor = pc.BlendByAlpha(color).ABGR();
+					memcpy(pixel, &newColor, curbpp);
+				}
+			}
+		});
+
+		delete[] distances;
 	}
 }
 
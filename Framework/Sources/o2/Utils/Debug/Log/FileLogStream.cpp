@@ -1,37 +1,208 @@
 #include "o2/stdafx.h"
 #include "FileLogStream.h"
 
-#include <fstream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 
 namespace o2
 {
 	FileLogStream::FileLogStream(const String& fileName):
-		LogStream(), filename(fileName)
+		LogStream(), mFilename(fileName)
 	{
-		std::fstream ofs(filename, std::ios::out);
-		if (ofs) 
-			ofs.close();
+		Initialize();
 	}
 
 	FileLogStream::FileLogStream(const WString& id, const String& fileName):
-		LogStream(id), filename(fileName)
+		LogStream(id), mFilename(fileName)
 	{
-		std::fstream ofs(filename, std::ios::out);
-		if (ofs)
-			ofs.close();
+		Initialize();
 	}
 
 	FileLogStream::~FileLogStream()
 	{
+		{
+			std::unique_lock<std::mutex> lock(mWriterMutex);
+			mStopped = true;
+		}
+
+		mWriterCV.notify_one();
+		mWriterThread.join();
+
+		mFile.close();
+		delete[] mRecords;
+	}
+
+	void FileLogStream::SetMaxFileSize(UInt64 size)
+	{
+		mMaxFileSize = size;
+	}
+
+	UInt64 FileLogStream::GetMaxFileSize() const
+	{
+		return mMaxFileSize;
+	}
+
+	int FileLogStream::GetDroppedMessagesCount() const
+	{
+		return mDroppedCount;
+	}
+
+	void FileLogStream::Flush()
+	{
+		UInt64 position = mWritePosition;
+
+		std::unique_lock<std::mutex> lock(mWriterMutex);
+		mFlushRequested = true;
+		mWriterCV.notify_one();
+		mFlushedCV.wait(lock, [&]() { return mWrittenPosition >= position || mStopped; });
+	}
+
+	void FileLogStream::Initialize()
+	{
+		mMaxFileSize = 10*1024*1024;
+		mWritePosition = 0;
+		mDroppedCount = 0;
+
+		mRecords = mnew Record[mRecordsCount];
+		for (int i = 0; i < mRecordsCount; i++)
+			mRecords[i].sequence = i;
+
+		mFile.open(mFilename.Data(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+		mWriterThread = std::thread(&FileLogStream::WriterThread, this);
 	}
 
 	void FileLogStream::OutStrEx(const WString& str)
 	{
-		/*std::fstream ofs(mFilename, std::ios::app);
-		if (ofs)
+		int length = Math::Min(str.Length(), mRecordLength*mMaxMessageRecords);
+		int recordsCount = Math::Max((length + mRecordLength - 1)/mRecordLength, 1);
+
+		// Reserve sequential records for whole message. Records can only become free while checking,
+		// so they are still free when position is captured
+		UInt64 position = mWritePosition.load(std::memory_order_relaxed);
+		while (true)
 		{
-			ofs << ((String)str).Data() << std::endl;
-			ofs.close();
-		}*/
+			bool isFree = true;
+			for (int i = 0; i < recordsCount && isFree; i++)
+				isFree = mRecords[(position + i)%mRecordsCount].sequence.load(std::memory_order_acquire) == position + i;
+
+			if (isFree)
+			{
+				if (mWritePosition.compare_exchange_weak(position, position + recordsCount, std::memory_order_relaxed))
+					break;
+
+				continue;
+			}
+
+			UInt64 actualPosition = mWritePosition.load(std::memory_order_relaxed);
+			if (actualPosition == position)
+			{
+				mDroppedCount++;
+				mWriterCV.notify_one();
+				return;
+			}
+
+			position = actualPosition;
+		}
+
+		for (int i = 0; i < recordsCount; i++)
+		{
+			Record& record = mRecords[(position + i)%mRecordsCount];
+			int begin = i*mRecordLength;
+
+			record.length = Math::Min(length - begin, mRecordLength);
+			record.partsLeft = recordsCount - i - 1;
+			memcpy(record.text, str.Data() + begin, record.length*sizeof(wchar_t));
+
+			record.sequence.store(position + i + 1, std::memory_order_release);
+		}
+
+		// Wake writer each quarter of buffer, otherwise it wakes up by interval
+		const UInt64 wakeStep = mRecordsCount/4;
+		if ((position + recordsCount)/wakeStep != position/wakeStep)
+			mWriterCV.notify_one();
+	}
+
+	void FileLogStream::WriterThread()
+	{
+		while (true)
+		{
+			bool stopped;
+
+			{
+				std::unique_lock<std::mutex> lock(mWriterMutex);
+				mWriterCV.wait_for(lock, std::chrono::milliseconds(mWriteIntervalMs), [&]() { return mStopped || mFlushRequested; });
+				stopped = mStopped;
+			}
+
+			WriteRecords();
+
+			{
+				std::unique_lock<std::mutex> lock(mWriterMutex);
+				mWrittenPosition = mReadPosition;
+				mFlushRequested = false;
+			}
+
+			mFlushedCV.notify_all();
+
+			if (stopped)
+				return;
+		}
+	}
+
+	void FileLogStream::WriteRecords()
+	{
+		String batch;
+
+		while (true)
+		{
+			Record& record = mRecords[mReadPosition%mRecordsCount];
+			if (record.sequence.load(std::memory_order_acquire) != mReadPosition + 1)
+				break;
+
+			mPendingMessage.append(record.text, record.length);
+			bool isLastPart = record.partsLeft == 0;
+
+			record.sequence.store(mReadPosition + mRecordsCount, std::memory_order_release);
+			mReadPosition++;
+
+			if (isLastPart)
+			{
+				batch += (String)mPendingMessage;
+				batch += "\n";
+				mPendingMessage.Clear();
+			}
+		}
+
+		int droppedCount = mDroppedCount;
+		if (droppedCount != mReportedDroppedCount)
+		{
+			batch += "WARNING:Log buffer overflow, dropped " + (String)(droppedCount - mReportedDroppedCount) + " messages\n";
+			mReportedDroppedCount = droppedCount;
+		}
+
+		if (batch.IsEmpty() || !mFile)
+			return;
+
+		UInt64 maxFileSize = mMaxFileSize;
+		if (maxFileSize > 0 && mFileSize > 0 && mFileSize + batch.Length() > maxFileSize)
+			RotateFile();
+
+		mFile.write(batch.Data(), batch.Length());
+		mFile.flush();
+		mFileSize += batch.Length();
+	}
+
+	void FileLogStream::RotateFile()
+	{
+		mFile.close();
+
+		String rotatedFilename = mFilename + ".1";
+		std::remove(rotatedFilename.Data());
+		std::rename(mFilename.Data(), rotatedFilename.Data());
+
+		mFile.open(mFilename.Data(), std::ios::out | std::ios::trunc | std::ios::binary);
+		mFileSize = 0;
 	}
 }
@@ -1,16 +1,21 @@
 #pragma once
 
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace o2
 {
-	// ----------------------------------------
-	// File log stream, puts messages into file
-	// ----------------------------------------
+	// -----------------------------------------------------------------------------------------------
+	// File log stream, puts messages into file. Messages are copied into lock-free ring buffer of fixed
+	// size records, background thread formats and writes them in batches. When buffer is full message
+	// is dropped and counted, caller is never blocked. File is moved to fileName.1 when exceeds max size
+	// -----------------------------------------------------------------------------------------------
 	class FileLogStream:public LogStream
 	{
-		String filename; // Target file
-
 	public:
 		// Constructor with file name
 		FileLogStream(const String& fileName);
@@ -18,11 +23,73 @@ namespace o2
 		// Constructor with id and file name
 		FileLogStream(const WString& id, const String& fileName);
 
-		// Destructor
+		// Destructor. Writes remaining messages and stops writer thread
 		~FileLogStream();
 
+		// Sets maximum file size in bytes. Zero disables rotation
+		void SetMaxFileSize(UInt64 size);
+
+		// Returns maximum file size in bytes
+		UInt64 GetMaxFileSize() const;
+
+		// Returns count of messages dropped because of buffer overflow
+		int GetDroppedMessagesCount() const;
+
+		// Blocks until all messages put before are written into file
+		void Flush();
+
+	protected:
+		static const int mRecordLength = 128;     // Record text length in characters
+		static const int mRecordsCount = 2048;    // Ring buffer records count
+		static const int mMaxMessageRecords = 64; // Maximum records per message, longer messages are truncated
+		static const int mWriteIntervalMs = 50;   // Writer thread sleep interval
+
+		// -------------------------------------------------------------------------------
+		// Ring buffer record. Long messages take several sequential records in the buffer
+		// -------------------------------------------------------------------------------
+		struct Record
+		{
+			std::atomic<UInt64> sequence;            // Equals write position when record is free, position + 1 when filled
+			int                 partsLeft = 0;       // Count of following records of same message
+			int                 length = 0;          // Text length
+			wchar_t             text[mRecordLength]; // Message text part
+		};
+
 	protected:
-		// Outs string into file
-		void OutStrEx(const WString& str);
+		String              mFilename;                   // Target file
+		std::ofstream       mFile;                       // Target file stream. Used only from writer thread
+		UInt64              mFileSize = 0;               // Current file size
+		std::atomic<UInt64> mMaxFileSize;                // Maximum file size, zero when rotation is disabled
+
+		Record*             mRecords = nullptr;          // Ring buffer records
+		std::atomic<UInt64> mWritePosition;              // Next position for producers
+		UInt64              mReadPosition = 0;           // Next position to read by writer thread
+		WString             mPendingMessage;             // Message which parts are not read completely yet
+		std::atomic<int>    mDroppedCount;               // Count of dropped messages
+		int                 mReportedDroppedCount = 0;   // Count of dropped messages reported into file
+
+		std::thread             mWriterThread;           // Background writer thread
+		std::mutex              mWriterMutex;            // Writer state mutex
+		std::condition_variable mWriterCV;               // Wakes writer thread
+		std::condition_variable mFlushedCV;              // Notifies waiting flushes about written records
+		UInt64                  mWrittenPosition = 0;    // Position of records written into file. Guarded by writer mutex
+		bool                    mFlushRequested = false; // Is flush requested. Guarded by writer mutex
+		bool                    mStopped = false;        // Is stream stopping. Guarded by writer mutex
+
+	protected:
+		// Opens file, initializes buffer and starts writer thread
+		void Initialize();
+
+		// Puts string into ring buffer
+		void OutStrEx(const WString& str) override;
+
+		// Writer thread function
+		void WriterThread();
+
+		// Reads filled records and writes them into file
+		void WriteRecords();
+
+		// Moves current file into fileName.1 and opens new one
+		void RotateFile();
 	};
 }
@@ -953,5 +953,19 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::DragHandle);
+CLASS_SERIALIZATION_META(o2::DragHandle)
+{
+	SERIALIZABLE_FIELD_DEFAULT(mRegularSprite, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mHoverSprite, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mPressedSprite, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectedSprite, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectedHoverSprite, nullptr);
+	SERIALIZABLE_FIELD_DEFAULT(mSelectedPressedSprite, nullptr);
+}
+END_META;
 
 DECLARE_CLASS(o2::WidgetDragHandle);
+CLASS_SERIALIZATION_META(o2::WidgetDragHandle)
+{
+}
+END_META;
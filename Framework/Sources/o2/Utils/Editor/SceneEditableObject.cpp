@@ -160,3 +160,7 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::SceneEditableObject);
+CLASS_SERIALIZATION_META(o2::SceneEditableObject)
+{
+}
+END_META;
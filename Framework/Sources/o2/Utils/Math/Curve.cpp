@@ -905,5 +905,22 @@ ENUM_META(o2::Curve::Key::Type)
 END_ENUM_META;
 
 DECLARE_CLASS(o2::Curve);
+CLASS_SERIALIZATION_META(o2::Curve)
+{
+	SERIALIZABLE_FIELD(mKeys);
+}
+END_META;
 
 DECLARE_CLASS(o2::Curve::Key);
+CLASS_SERIALIZATION_META(o2::Curve::Key)
+{
+	SERIALIZABLE_FIELD(uid);
+	SERIALIZABLE_FIELD(value);
+	SERIALIZABLE_FIELD(position);
+	SERIALIZABLE_FIELD(leftSupportValue);
+	SERIALIZABLE_FIELD(leftSupportPosition);
+	SERIALIZABLE_FIELD(rightSupportValue);
+	SERIALIZABLE_FIELD(rightSupportPosition);
+	SERIALIZABLE_FIELD(supportsType);
+}
+END_META;
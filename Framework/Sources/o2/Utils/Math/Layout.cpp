@@ -191,3 +191,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Layout);
+CLASS_SERIALIZATION_META(o2::Layout)
+{
+	SERIALIZABLE_FIELD_DEFAULT(anchorMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(anchorMax, Vec2F(1, 1));
+	SERIALIZABLE_FIELD_DEFAULT(offsetMin, Vec2F(0, 0));
+	SERIALIZABLE_FIELD_DEFAULT(offsetMax, Vec2F(0, 0));
+}
+END_META;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Pseudo random numbers generator with own state. Sequence depends only on seed, so separate
+	// generators can be used from different threads and give same results in each run
+	// -----------------------------------------------------------------------------------------------
+	class RandomGenerator
+	{
+	public:
+		// Constructor with seed
+		inline RandomGenerator(UInt seed = 1);
+
+		// Sets seed and restarts sequence
+		inline void SetSeed(UInt seed);
+
+		// Returns seed
+		inline UInt GetSeed() const;
+
+		// Returns next random integer
+		inline UInt Next();
+
+		// Returns next random value in [0, 1) range
+		inline float NextFloat();
+
+		// Returns next random value in range
+		template<typename T>
+		inline T Range(const T& minValue, const T& maxValue);
+
+		// Check equals operator
+		inline bool operator==(const RandomGenerator& other) const;
+
+	protected:
+		UInt mSeed;  // Sequence seed
+		UInt mState; // Current generator state, never zero
+	};
+
+	RandomGenerator::RandomGenerator(UInt seed /*= 1*/)
+	{
+		SetSeed(seed);
+	}
+
+	void RandomGenerator::SetSeed(UInt seed)
+	{
+		mSeed = seed;
+
+		// Mix seed bits, close seeds must give different sequences
+		mState = seed*0x9E3779B9u + 0x6D2B79F5u;
+		mState ^= mState >> 16;
+		mState *= 0x85EBCA6Bu;
+		mState ^= mState >> 13;
+
+		if (mState == 0)
+			mState = 1;
+	}
+
+	UInt RandomGenerator::GetSeed() const
+	{
+		return mSeed;
+	}
+
+	UInt RandomGenerator::Next()
+	{
+		// xorshift32
+		mState ^= mState << 13;
+		mState ^= mState >> 17;
+		mState ^= mState << 5;
+		return mState;
+	}
+
+	float RandomGenerator::NextFloat()
+	{
+		return (float)(Next() >> 8)*(1.0f/16777216.0f);
+	}
+
+	template<typename T>
+	T RandomGenerator::Range(const T& minValue, const T& maxValue)
+	{
+		return (T)(NextFloat()*(float)(maxValue - minValue) + (float)minValue);
+	}
+
+	bool RandomGenerator::operator==(const RandomGenerator& other) const
+	{
+		return mSeed == other.mSeed && mState == other.mState;
+	}
+}
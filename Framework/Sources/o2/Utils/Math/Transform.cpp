@@ -417,3 +417,13 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::Transform);
+CLASS_SERIALIZATION_META(o2::Transform)
+{
+	SERIALIZABLE_FIELD(mPosition);
+	SERIALIZABLE_FIELD(mSize);
+	SERIALIZABLE_FIELD(mScale);
+	SERIALIZABLE_FIELD(mPivot);
+	SERIALIZABLE_FIELD(mAngle);
+	SERIALIZABLE_FIELD(mShear);
+}
+END_META;
@@ -0,0 +1,188 @@
+#include "o2/stdafx.h"
+#include "FieldPath.h"
+
+#include "o2/Utils/Reflection/FieldInfo.h"
+
+namespace o2
+{
+	FieldPath::FieldPath()
+	{}
+
+	FieldPath::FieldPath(const String& path):
+		mPath(path)
+	{}
+
+	bool FieldPath::operator==(const FieldPath& other) const
+	{
+		return mPath == other.mPath && mResolvedType == other.mResolvedType;
+	}
+
+	void FieldPath::SetPath(const String& path)
+	{
+		mPath = path;
+		mResolvedType = nullptr;
+		mSteps.Clear();
+	}
+
+	const String& FieldPath::GetPath() const
+	{
+		return mPath;
+	}
+
+	void FieldPath::Resolve(const Type* type)
+	{
+		mResolvedType = type;
+		mSteps.Clear();
+
+		const Type* currentType = type;
+		int partBegin = 0;
+		while (currentType)
+		{
+			int delPos = mPath.Find('/', partBegin);
+			bool isLastPart = delPos < 0;
+			int partEnd = isLastPart ? mPath.Length() : delPos;
+
+			Step step;
+			step.type = currentType;
+
+			auto usage = currentType->GetUsage();
+			if (usage == Type::Usage::Vector)
+			{
+				auto vectorType = dynamic_cast<const VectorType*>(currentType);
+				String part = mPath.SubStr(partBegin, partEnd);
+
+				if (part == "count")
+				{
+					step.stepType = StepType::VectorCount;
+					mSteps.Add(step);
+					return;
+				}
+
+				auto elementType = vectorType->GetElementType();
+
+				step.stepType = StepType::VectorElement;
+				step.index = (int)part;
+				step.isPointerElement = elementType->GetUsage() == Type::Usage::Pointer;
+				mSteps.Add(step);
+
+				if (isLastPart)
+					return;
+
+				currentType = step.isPointerElement ? dynamic_cast<const PointerType*>(elementType)->GetUnpointedType() : elementType;
+			}
+			else if (usage == Type::Usage::Regular || usage == Type::Usage::Object)
+			{
+				auto entry = currentType->FindFieldEntry(std::string_view(mPath.Data() + partBegin, partEnd - partBegin));
+				if (!entry)
+					break;
+
+				step.stepType = StepType::Field;
+				step.field = entry->field;
+				step.castsBegin = entry->castsBegin;
+				step.castsCount = entry->castsCount;
+				mSteps.Add(step);
+
+				if (isLastPart)
+					return;
+
+				auto fieldType = entry->field->GetType();
+				if (!fieldType)
+				{
+					// Field without type can't have nested fields, path is not valid
+					mSteps.Clear();
+					return;
+				}
+
+				if (fieldType->GetUsage() == Type::Usage::Pointer)
+					currentType = dynamic_cast<const PointerType*>(fieldType)->GetUnpointedType();
+				else
+					currentType = fieldType;
+			}
+			else
+				break;
+
+			partBegin = delPos + 1;
+		}
+
+		// Rest of path is searched by names for each object, it depends on object's value
+		Step step;
+		step.stepType = StepType::Search;
+		step.type = currentType;
+		step.searchPath = mPath.SubStr(partBegin);
+		mSteps.Add(step);
+	}
+
+	const Type* FieldPath::GetResolvedType() const
+	{
+		return mResolvedType;
+	}
+
+	void* FieldPath::GetFieldPtr(void* object, const FieldInfo*& fieldInfo) const
+	{
+		for (int i = 0; i < mSteps.Count() && object; i++)
+		{
+			const Step& step = mSteps[i];
+			bool isLastStep = i == mSteps.Count() - 1;
+
+			switch (step.stepType)
+			{
+				case StepType::Field:
+				{
+					for (int j = step.castsBegin, end = step.castsBegin + step.castsCount; j < end; j++)
+						object = (*step.type->mBaseCastFuncs[j])(object);
+
+					if (isLastStep)
+					{
+						fieldInfo = step.field;
+						return step.field->GetValuePtrStrong(object);
+					}
+
+					object = step.field->GetValuePtr(object);
+					break;
+				}
+
+				case StepType::VectorElement:
+				{
+					auto vectorType = (const VectorType*)step.type;
+					if (step.index < 0 || step.index >= vectorType->GetObjectVectorSize(object))
+						return nullptr;
+
+					object = vectorType->GetObjectVectorElementPtr(object, step.index);
+
+					if (isLastStep)
+					{
+						fieldInfo = vectorType->GetElementFieldInfo();
+						return object;
+					}
+
+					if (step.isPointerElement)
+						object = *(void**)object;
+
+					break;
+				}
+
+				case StepType::VectorCount:
+				{
+					fieldInfo = ((const VectorType*)step.type)->GetCountFieldInfo();
+					return object;
+				}
+
+				case StepType::Search:
+				{
+					if (!step.type)
+						return nullptr;
+
+					return step.type->GetFieldPtr(object, step.searchPath, fieldInfo);
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool FieldPath::Step::operator==(const Step& other) const
+	{
+		return stepType == other.stepType && type == other.type && field == other.field && index == other.index &&
+			searchPath == other.searchPath;
+	}
+}
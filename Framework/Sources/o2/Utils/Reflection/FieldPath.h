@@ -0,0 +1,68 @@
+#pragma once
+
+#include "o2/Utils/Reflection/Type.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	class FieldInfo;
+
+	// -----------------------------------------------------------------------------------------------
+	// Parsed field path, like "transform/position". Resolved once for type, then returns field pointer
+	// for any object of this type without names searching. Parts which can't be resolved by type,
+	// like fields of derived types, are searched by name at getting pointer
+	// -----------------------------------------------------------------------------------------------
+	class FieldPath
+	{
+	public:
+		// Default constructor
+		FieldPath();
+
+		// Constructor with path
+		FieldPath(const String& path);
+
+		// Check equals operator
+		bool operator==(const FieldPath& other) const;
+
+		// Sets path, resets resolved type
+		void SetPath(const String& path);
+
+		// Returns path
+		const String& GetPath() const;
+
+		// Resolves path parts for type
+		void Resolve(const Type* type);
+
+		// Returns type for which path is resolved
+		const Type* GetResolvedType() const;
+
+		// Returns field pointer in object of resolved type and field info
+		void* GetFieldPtr(void* object, const FieldInfo*& fieldInfo) const;
+
+	protected:
+		enum class StepType { Field, VectorElement, VectorCount, Search };
+
+		// -----------------------------
+		// Resolved path part processing
+		// -----------------------------
+		struct Step
+		{
+			StepType         stepType = StepType::Search;
+			const Type*      type = nullptr;           // Object type on this step
+			const FieldInfo* field = nullptr;          // Field info on field step
+			int              castsBegin = 0;           // Field owner casts begin in type's casts chains
+			int              castsCount = 0;           // Field owner casts count
+			int              index = 0;                // Vector element index
+			bool             isPointerElement = false; // Is vector element pointer, it is dereferenced for next step
+			String           searchPath;               // Rest of path for searching by names
+
+			bool operator==(const Step& other) const;
+		};
+
+	protected:
+		String       mPath;                   // Field path, parts are separated by "/"
+		const Type*  mResolvedType = nullptr; // Type for which path is resolved
+		Vector<Step> mSteps;                  // Resolved steps
+	};
+}
@@ -11,6 +11,8 @@
 #include "o2/Utils/Math/Vertex2.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace o2
 {
@@ -81,6 +83,8 @@ namespace o2
 
 		mInstance->mInitializingFunctions.Clear();
 		mInstance->mTypesInitialized = true;
+
+		InitializeTypesRelations();
 	}
 
 	const Map<String, Type*>& Reflection::GetTypes()
@@ -125,4 +129,115 @@ namespace o2
 		mInstance->mTypes[FundamentalTypeContainer<void>::type->GetName()] = FundamentalTypeContainer<void>::type;
 		mInstance->mTypes[Type::Dummy::type->GetName()] = Type::Dummy::type;
 	}
+
+	void Reflection::InitializeTypesRelations()
+	{
+		// Base types can be not registered by name, like IObject. They are collected from registered types
+		Vector<Type*> types;
+		std::unordered_set<const Type*> typesSet;
+		for (auto& kv : mInstance->mTypes)
+		{
+			if (typesSet.insert(kv.second).second)
+				types.Add(kv.second);
+		}
+
+		for (int i = 0; i < types.Count(); i++)
+		{
+			for (auto& baseType : types[i]->mBaseTypes)
+			{
+				if (typesSet.insert(baseType.type).second)
+					types.Add(const_cast<Type*>(baseType.type));
+			}
+		}
+
+		for (auto type : types)
+		{
+			type->mDirectDerivedTypes.Clear();
+			type->mDerivedTypes.Clear();
+			type->mSecondaryBaseTypes.Clear();
+			type->mRelationsInitialized = false;
+		}
+
+		// Numbers types in pre-order of tree by first base types. Derived type is inside base's (begin, end) interval
+		std::unordered_map<const Type*, Vector<Type*>> firstBaseChildren;
+		for (auto type : types)
+		{
+			if (!type->mBaseTypes.IsEmpty())
+				firstBaseChildren[type->mBaseTypes[0].type].Add(type);
+		}
+
+		int index = 0;
+		Vector<Pair<Type*, int>> stack;
+		for (auto root : types)
+		{
+			if (!root->mBaseTypes.IsEmpty())
+				continue;
+
+			root->mHierarchyBegin = index++;
+			stack.Add({ root, 0 });
+
+			while (!stack.IsEmpty())
+			{
+				auto& top = stack.Last();
+				auto fnd = firstBaseChildren.find(top.first);
+				if (fnd != firstBaseChildren.end() && top.second < fnd->second.Count())
+				{
+					Type* child = fnd->second[top.second++];
+					child->mHierarchyBegin = index++;
+					stack.Add({ child, 0 });
+					continue;
+				}
+
+				top.first->mHierarchyEnd = index;
+				stack.PopBack();
+			}
+		}
+
+		for (auto type : types)
+		{
+			// Collects bases which are not in first base types chain, they are checked by list
+			Vector<const Type*> processBases;
+			for (const Type* base = type; base; base = base->mBaseTypes.IsEmpty() ? nullptr : base->mBaseTypes[0].type)
+			{
+				for (int i = 1; i < base->mBaseTypes.Count(); i++)
+					processBases.Add(base->mBaseTypes[i].type);
+			}
+
+			while (!processBases.IsEmpty())
+			{
+				const Type* base = processBases.PopBack();
+				bool isFirstBasesChain = type->mHierarchyBegin > base->mHierarchyBegin && type->mHierarchyBegin < base->mHierarchyEnd;
+				if (isFirstBasesChain || type->mSecondaryBaseTypes.Contains(base))
+					continue;
+
+				type->mSecondaryBaseTypes.Add(base);
+
+				for (auto& baseBase : base->mBaseTypes)
+					processBases.Add(baseBase.type);
+			}
+
+			// Registers type in all bases derived types lists
+			for (auto& baseType : type->mBaseTypes)
+			{
+				if (!baseType.type->mDirectDerivedTypes.Contains(type))
+					baseType.type->mDirectDerivedTypes.Add(type);
+			}
+
+			for (const Type* base = type->mBaseTypes.IsEmpty() ? nullptr : type->mBaseTypes[0].type; base;
+				 base = base->mBaseTypes.IsEmpty() ? nullptr : base->mBaseTypes[0].type)
+			{
+				base->mDerivedTypes.Add(type);
+			}
+
+			for (auto base : type->mSecondaryBaseTypes)
+				base->mDerivedTypes.Add(type);
+		}
+
+		// Flattened fields and functions lists, bases are initialized first by recursion
+		for (auto type : types)
+		{
+			if (!type->mRelationsInitialized)
+				type->InitializeRelations();
+		}
+	}
 }
@@ -122,6 +122,9 @@ namespace o2
 		// Initializes fundamental types
 		static void InitializeFundamentalTypes();
 
+		// Numbers types in base types tree and builds cached derived types, fields and functions lists
+		static void InitializeTypesRelations();
+
 		friend class Type;
 	};
 
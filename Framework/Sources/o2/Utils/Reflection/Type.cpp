@@ -49,11 +49,23 @@ namespace o2
 		if (mId == other.mId)
 			return true;
 
-		for (auto typeInfo : mBaseTypes)
+		// Numbered types are checked by first base types tree intervals and short list of other bases
+		if (mHierarchyBegin >= 0 && other.mHierarchyBegin >= 0)
 		{
-			if (typeInfo.type->mId == mId)
+			if (mHierarchyBegin > other.mHierarchyBegin && mHierarchyBegin < other.mHierarchyEnd)
 				return true;
 
+			for (auto baseType : mSecondaryBaseTypes)
+			{
+				if (baseType->mId == other.mId)
+					return true;
+			}
+
+			return false;
+		}
+
+		for (auto typeInfo : mBaseTypes)
+		{
 			if (typeInfo.type->IsBasedOn(other))
 				return true;
 		}
@@ -76,16 +88,12 @@ namespace o2
 		return mFields;
 	}
 
-	Vector<const FieldInfo*> Type::GetFieldsWithBaseClasses() const
+	const Vector<const FieldInfo*>& Type::GetFieldsWithBaseClasses() const
 	{
-		Vector<const FieldInfo*> res;
-
-		for (auto baseType : mBaseTypes)
-			res += baseType.type->GetFieldsWithBaseClasses();
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		res += mFields.Convert<const FieldInfo*>([](auto& x) { return &x; });
-
-		return res;
+		return mFieldsWithBaseClasses;
 	}
 
 	const Vector<FunctionInfo*>& Type::GetFunctions() const
@@ -98,137 +106,205 @@ namespace o2
 		return mStaticFunctions;
 	}
 
-	Vector<FunctionInfo*> Type::GetFunctionsWithBaseClasses() const
+	const Vector<FunctionInfo*>& Type::GetFunctionsWithBaseClasses() const
 	{
-		Vector<FunctionInfo*> res;
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		for (auto baseType : mBaseTypes)
-			res += baseType.type->GetFunctionsWithBaseClasses();
+		return mFunctionsWithBaseClasses;
+	}
 
-		res += mFunctions;
+	const Vector<StaticFunctionInfo*>& Type::GetStaticFunctionsWithBaseClasses() const
+	{
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		return res;
+		return mStaticFunctionsWithBaseClasses;
 	}
 
-	Vector<StaticFunctionInfo*> Type::GetStaticFunctionsWithBaseClasses() const
+	const FieldInfo* Type::GetField(const String& name) const
 	{
-		Vector<StaticFunctionInfo*> res;
+		if (auto entry = FindFieldEntry(std::string_view(name.Data(), name.Length())))
+			return entry->field;
 
-		for (auto baseType : mBaseTypes)
-			res += baseType.type->GetStaticFunctionsWithBaseClasses();
+		return nullptr;
+	}
+
+	const FunctionInfo* Type::GetFunction(const String& name) const
+	{
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		res += mStaticFunctions;
+		auto fnd = mFunctionsByName.find(std::string_view(name.Data(), name.Length()));
+		if (fnd != mFunctionsByName.end())
+			return fnd->second;
 
-		return res;
+		return nullptr;
 	}
 
-	const FieldInfo* Type::GetField(const String& name) const
+	const StaticFunctionInfo* Type::GetStaticFunction(const String& name) const
 	{
-		for (auto& field : mFields)
-		{
-			if (field.GetName() == name)
-				return &field;
-		}
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		for (auto baseType : mBaseTypes)
-		{
-			if (auto res = baseType.type->GetField(name))
-				return res;
-		}
+		auto fnd = mStaticFunctionsByName.find(std::string_view(name.Data(), name.Length()));
+		if (fnd != mStaticFunctionsByName.end())
+			return fnd->second;
 
 		return nullptr;
 	}
 
-	const FunctionInfo* Type::GetFunction(const String& name) const
+	const Type::FieldEntry* Type::FindFieldEntry(const std::string_view& name) const
 	{
-		for (auto func : mFunctions)
-		{
-			if (func->mName == name)
-				return func;
-		}
+		if (!mRelationsInitialized)
+			InitializeRelations();
 
-		for (auto& base : mBaseTypes)
-		{
-			if (auto func = base.type->GetFunction(name))
-				return func;
-		}
+		auto fnd = mFieldsByName.find(name);
+		if (fnd != mFieldsByName.end())
+			return &fnd->second;
 
 		return nullptr;
 	}
 
-	const StaticFunctionInfo* Type::GetStaticFunction(const String& name) const
+	void* Type::CastToFieldOwner(void* object, const FieldEntry& entry) const
 	{
-		for (auto func : mStaticFunctions)
-		{
-			if (func->mName == name)
-				return func;
-		}
+		for (int i = entry.castsBegin, end = entry.castsBegin + entry.castsCount; i < end; i++)
+			object = (*mBaseCastFuncs[i])(object);
 
-		for (auto& base : mBaseTypes)
-		{
-			if (auto func = base.type->GetStaticFunction(name))
-				return func;
-		}
+		return object;
+	}
 
-		return nullptr;
+	const Vector<const Type*>& Type::GetDerivedTypes(bool deep /*= true*/) const
+	{
+		if (!mRelationsInitialized)
+			InitializeRelations();
+
+		return deep ? mDerivedTypes : mDirectDerivedTypes;
 	}
 
-	Vector<const Type*> Type::GetDerivedTypes(bool deep /*= true*/) const
+	void Type::InitializeRelations() const
 	{
-		Vector<const Type*> res;
-		for (auto kv : Reflection::GetTypes())
+		mFieldsWithBaseClasses.Clear();
+		mFunctionsWithBaseClasses.Clear();
+		mStaticFunctionsWithBaseClasses.Clear();
+
+		for (auto baseType : mBaseTypes)
 		{
-			auto baseTypes = kv.second->GetBaseTypes();
-			for (auto baseType : baseTypes)
-			{
-				if (baseType.type->mId == mId)
-					res.Add(kv.second);
-			}
+			auto base = baseType.type;
+			if (!base->mRelationsInitialized)
+				base->InitializeRelations();
+
+			mFieldsWithBaseClasses += base->mFieldsWithBaseClasses;
+			mFunctionsWithBaseClasses += base->mFunctionsWithBaseClasses;
+			mStaticFunctionsWithBaseClasses += base->mStaticFunctionsWithBaseClasses;
 		}
 
-		if (deep)
+		for (auto& field : mFields)
+			mFieldsWithBaseClasses.Add(&field);
+
+		mFunctionsWithBaseClasses += mFunctions;
+		mStaticFunctionsWithBaseClasses += mStaticFunctions;
+
+		InitializeNamesTables();
+
+		// Derived types of numbered types are collected by reflection, others are searched here
+		if (mHierarchyBegin < 0)
 		{
-			auto resCopy = res;
-			for (auto type : resCopy)
-				res += type->GetDerivedTypes(true);
+			mDirectDerivedTypes.Clear();
+			mDerivedTypes.Clear();
+
+			for (auto& kv : Reflection::GetTypes())
+			{
+				if (kv.second == this)
+					continue;
+
+				for (auto& baseType : kv.second->mBaseTypes)
+				{
+					if (baseType.type->mId == mId)
+						mDirectDerivedTypes.Add(kv.second);
+				}
+
+				if (kv.second->IsBasedOn(*this))
+					mDerivedTypes.Add(kv.second);
+			}
 		}
 
-		return res;
+		// Types are still registering while initialization, cache is built again after it
+		mRelationsInitialized = Reflection::IsTypesInitialized();
 	}
 
-	void* Type::GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const
+	void Type::InitializeNamesTables() const
 	{
-		int delPos = path.Find("/");
-		WString pathPart = path.SubStr(0, delPos);
+		mFieldsByName.clear();
+		mFunctionsByName.clear();
+		mStaticFunctionsByName.clear();
+		mBaseCastFuncs.Clear();
 
+		// Own members are added first, then base types members in bases order. Existing names are not replaced,
+		// so lookup result is same as searching in this type and then in base types recursively
 		for (auto& field : mFields)
+			mFieldsByName.emplace(std::string_view(field.mName.Data(), field.mName.Length()), FieldEntry{ &field, 0, 0 });
+
+		for (auto func : mFunctions)
+			mFunctionsByName.emplace(std::string_view(func->mName.Data(), func->mName.Length()), func);
+
+		for (auto func : mStaticFunctions)
+			mStaticFunctionsByName.emplace(std::string_view(func->mName.Data(), func->mName.Length()), func);
+
+		for (auto& baseType : mBaseTypes)
 		{
-			if (field.mName == pathPart)
+			auto base = baseType.type;
+
+			// Base casts chains are prepended with cast to base. Chains are shared by fields of same base type
+			std::unordered_map<int, int> castsChains;
+			for (auto& kv : base->mFieldsByName)
 			{
-				if (delPos == -1)
-				{
-					fieldInfo = &field;
-					return field.GetValuePtrStrong(object);
-				}
-				else
-				{
-					void* val = field.GetValuePtr(object);
+				if (mFieldsByName.find(kv.first) != mFieldsByName.end())
+					continue;
 
-					if (!val)
-						return nullptr;
+				int chainKey = kv.second.castsCount == 0 ? -1 : kv.second.castsBegin;
+				auto fnd = castsChains.find(chainKey);
+				if (fnd == castsChains.end())
+				{
+					int castsBegin = mBaseCastFuncs.Count();
+					mBaseCastFuncs.Add(baseType.dynamicCastUpFunc);
+					for (int i = 0; i < kv.second.castsCount; i++)
+						mBaseCastFuncs.Add(base->mBaseCastFuncs[kv.second.castsBegin + i]);
 
-					return field.SearchFieldPtr(val, path.SubStr(delPos + 1), fieldInfo);
+					fnd = castsChains.emplace(chainKey, castsBegin).first;
 				}
+
+				mFieldsByName.emplace(kv.first, FieldEntry{ kv.second.field, fnd->second, kv.second.castsCount + 1 });
 			}
+
+			for (auto& kv : base->mFunctionsByName)
+				mFunctionsByName.emplace(kv.first, kv.second);
+
+			for (auto& kv : base->mStaticFunctionsByName)
+				mStaticFunctionsByName.emplace(kv.first, kv.second);
 		}
+	}
 
-		for (auto baseType : mBaseTypes)
+	void* Type::GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const
+	{
+		int delPos = path.Find("/");
+		auto entry = FindFieldEntry(std::string_view(path.Data(), delPos < 0 ? path.Length() : delPos));
+		if (!entry)
+			return nullptr;
+
+		void* ownerObject = CastToFieldOwner(object, *entry);
+
+		if (delPos < 0)
 		{
-			if (auto res = baseType.type->Type::GetFieldPtr((*baseType.dynamicCastUpFunc)(object), path, fieldInfo))
-				return res;
+			fieldInfo = entry->field;
+			return entry->field->GetValuePtrStrong(ownerObject);
 		}
 
-		return nullptr;
+		void* val = entry->field->GetValuePtr(ownerObject);
+		if (!val)
+			return nullptr;
+
+		return entry->field->SearchFieldPtr(val, path.SubStr(delPos + 1), fieldInfo);
 	}
 
 	void Type::Serialize(void* ptr, DataValue& data) const
@@ -256,6 +332,24 @@ namespace o2
 		return mSerializer;
 	}
 
+	Type::SerializeFieldsFunc Type::GetSerializeFieldsFunc() const
+	{
+		return mSerializeFieldsFunc;
+	}
+
+	Type::DeserializeFieldsFunc Type::GetDeserializeFieldsFunc() const
+	{
+		return mDeserializeFieldsFunc;
+	}
+
+	bool TypeInitializer::RegSerializationFields(Type* type, Type::SerializeFieldsFunc serializeFunc, 
+												 Type::DeserializeFieldsFunc deserializeFunc)
+	{
+		type->mSerializeFieldsFunc = serializeFunc;
+		type->mDeserializeFieldsFunc = deserializeFunc;
+		return true;
+	}
+
 	VectorType::VectorType(const String& name, int size, ITypeSerializer* serializer) :
 		Type(name, size, serializer)
 	{}
@@ -10,6 +10,8 @@
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/StringDef.h"
+#include <string_view>
+#include <unordered_map>
 
 // Returns type of TYPE
 #define TypeOf(TYPE) GetTypeOf<TYPE>()
@@ -57,6 +59,18 @@ namespace o2
 			bool operator==(const BaseType& other) const { return type == other.type; }
 		};
 
+		typedef void*(*CastFunc)(void*);
+		typedef void(*SerializeFieldsFunc)(void*, DataValue&);
+		typedef void(*DeserializeFieldsFunc)(void*, const DataValue&);
+
+		// Field with casts from this type to field's owner base type
+		struct FieldEntry
+		{
+			const FieldInfo* field = nullptr;
+			int              castsBegin = 0; // First cast index in mBaseCastFuncs
+			int              castsCount = 0; // Count of casts, zero for own fields
+		};
+
 	public:
 		// Default constructor
 		Type(const String& name, int size, ITypeSerializer* serializer);
@@ -95,7 +109,7 @@ namespace o2
 		const Vector<FieldInfo>& GetFields() const;
 
 		// Returns fields informations array with all base types
-		Vector<const FieldInfo*> GetFieldsWithBaseClasses() const;
+		const Vector<const FieldInfo*>& GetFieldsWithBaseClasses() const;
 
 		// Returns functions informations array
 		const Vector<FunctionInfo*>& GetFunctions() const;
@@ -104,10 +118,10 @@ namespace o2
 		const Vector<StaticFunctionInfo*>& GetStaticFunctions() const;
 
 		// Returns functions informations array with all base types
-		Vector<FunctionInfo*> GetFunctionsWithBaseClasses() const;
+		const Vector<FunctionInfo*>& GetFunctionsWithBaseClasses() const;
 
 		// Returns functions informations array with all base types
-		Vector<StaticFunctionInfo*> GetStaticFunctionsWithBaseClasses() const;
+		const Vector<StaticFunctionInfo*>& GetStaticFunctionsWithBaseClasses() const;
 
 		// Returns field information by name
 		const FieldInfo* GetField(const String& name) const;
@@ -127,7 +141,7 @@ namespace o2
 		_res_type InvokeStatic(const String& name, _args ... args) const;
 
 		// Returns derived types
-		Vector<const Type*> GetDerivedTypes(bool deep = true) const;
+		const Vector<const Type*>& GetDerivedTypes(bool deep = true) const;
 
 		// Creates sample copy and returns him
 		virtual void* CreateSample() const = 0;
@@ -153,6 +167,12 @@ namespace o2
 		// Returns type serializer
 		ITypeSerializer* GetSerializer() const;
 
+		// Returns generated serialization function of own serializable fields, or null when not generated
+		SerializeFieldsFunc GetSerializeFieldsFunc() const;
+
+		// Returns generated deserialization function of own serializable fields, or null when not generated
+		DeserializeFieldsFunc GetDeserializeFieldsFunc() const;
+
 	public:
 		// --------------------
 		// Dummy type container
@@ -180,7 +200,40 @@ namespace o2
 
 		ITypeSerializer* mSerializer = nullptr; // Value serializer
 
+		SerializeFieldsFunc   mSerializeFieldsFunc = nullptr;   // Generated own serializable fields serialization function
+		DeserializeFieldsFunc mDeserializeFieldsFunc = nullptr; // Generated own serializable fields deserialization function
+
+		int                 mHierarchyBegin = -1; // Pre-order index in first base types tree, -1 when not numbered
+		int                 mHierarchyEnd = -1;   // Pre-order index after last derived type in first base types tree
+		Vector<const Type*> mSecondaryBaseTypes;  // Base types which are not in first base types chain, multiple inheritance
+
+		mutable Vector<const Type*>         mDirectDerivedTypes;              // Cached derived types
+		mutable Vector<const Type*>         mDerivedTypes;                    // Cached derived types with derived from them
+		mutable Vector<const FieldInfo*>    mFieldsWithBaseClasses;           // Cached fields with base types fields
+		mutable Vector<FunctionInfo*>       mFunctionsWithBaseClasses;        // Cached functions with base types functions
+		mutable Vector<StaticFunctionInfo*> mStaticFunctionsWithBaseClasses;  // Cached static functions with base types functions
+		mutable bool                        mRelationsInitialized = false;    // Is cached relations actual
+
+		mutable std::unordered_map<std::string_view, FieldEntry>                mFieldsByName;          // Fields with base types fields by name. Keys are fields names
+		mutable std::unordered_map<std::string_view, FunctionInfo*>             mFunctionsByName;       // Functions with base types functions by name
+		mutable std::unordered_map<std::string_view, StaticFunctionInfo*>       mStaticFunctionsByName; // Static functions with base types functions by name
+		mutable Vector<CastFunc>                                               mBaseCastFuncs;         // Casts chains to base types for inherited fields
+
+	protected:
+		// Builds cached relations of single type. Used for types created after reflection initialization
+		void InitializeRelations() const;
+
+		// Builds fields and functions by name tables
+		void InitializeNamesTables() const;
+
+		// Returns field entry by name with base types fields, or null
+		const FieldEntry* FindFieldEntry(const std::string_view& name) const;
+
+		// Returns pointer to field owner base type object by field entry
+		void* CastToFieldOwner(void* object, const FieldEntry& entry) const;
+
 		friend class FieldInfo;
+		friend class FieldPath;
 		friend class FunctionInfo;
 		friend class PointerType;
 		friend class Reflection;
@@ -676,6 +729,9 @@ namespace o2
 		// Registers static function in type
 		template<typename _class_type, typename _res_type, typename ... _args>
 		static StaticFunctionInfo* RegStaticFunction(Type* type, const String& name, _res_type(*pointer)(_args ...), ProtectSection section);
+
+		// Registers generated serialization functions of type's own serializable fields
+		static bool RegSerializationFields(Type* type, Type::SerializeFieldsFunc serializeFunc, Type::DeserializeFieldsFunc deserializeFunc);
 	};
 
 	// Here is the sample of type processing class
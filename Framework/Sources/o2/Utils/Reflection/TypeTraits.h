@@ -83,6 +83,12 @@ namespace o2
 	template<class T>
 	struct SupportsEqualOperator<T, void_t<decltype(std::declval<T>() == std::declval<T>())>>: std::true_type {};
 
+	template<class T, class T2, class = void_t<>>
+	struct SupportsEqualOperatorWith: std::false_type {};
+
+	template<class T, class T2>
+	struct SupportsEqualOperatorWith<T, T2, void_t<decltype(std::declval<T>() == std::declval<T2>())>>: std::true_type {};
+
 	template<class T, class = void>
 	struct ExtractPropertyValueType
 	{
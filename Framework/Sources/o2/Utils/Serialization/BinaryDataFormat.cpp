@@ -0,0 +1,367 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+namespace o2
+{
+	bool IsBinaryData(const char* data, UInt size)
+	{
+		return size >= BinaryDataFormat::HeaderSize &&
+			memcmp(data, BinaryDataFormat::Signature, sizeof(BinaryDataFormat::Signature)) == 0;
+	}
+
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document)
+	{
+		BinaryDataDocumentParser parser(data, size, document);
+		return parser.Parse();
+	}
+
+	void WriteBinary(String& str, const DataDocument& document)
+	{
+		BinaryDataDocumentWriter writer;
+		document.Write(writer);
+		writer.GetResult(str);
+	}
+
+	BinaryDataDocumentParser::BinaryDataDocumentParser(char* data, UInt size, DataDocument& document):
+		document(document), mData(data), mSize(size), mPosition(0)
+	{}
+
+	bool BinaryDataDocumentParser::Parse()
+	{
+		if (!IsBinaryData(mData, mSize))
+			return false;
+
+		mPosition = sizeof(BinaryDataFormat::Signature);
+
+		UInt version;
+		if (!Read(version) || version != BinaryDataFormat::Version)
+			return false;
+
+		UInt namesCount;
+		if (!Read(namesCount) || namesCount > (mSize - mPosition)/(sizeof(UInt) + 1))
+			return false;
+
+		mNames.Reserve(namesCount);
+		for (UInt i = 0; i < namesCount; i++)
+		{
+			Name name;
+			if (!ReadString(name.string, name.length))
+				return false;
+
+			mNames.Add(name);
+		}
+
+		DataValue root(document);
+		if (!ReadValue(root))
+			return false;
+
+		(DataValue&)document = std::move(root);
+		return true;
+	}
+
+	template<typename _type>
+	bool BinaryDataDocumentParser::Read(_type& value)
+	{
+		if (mSize - mPosition < sizeof(_type))
+			return false;
+
+		memcpy(&value, mData + mPosition, sizeof(_type));
+		mPosition += sizeof(_type);
+		return true;
+	}
+
+	bool BinaryDataDocumentParser::ReadString(const char*& string, UInt& length)
+	{
+		if (!Read(length) || length >= mSize - mPosition || mData[mPosition + length] != '\0')
+			return false;
+
+		string = mData + mPosition;
+		mPosition += length + 1;
+		return true;
+	}
+
+	bool BinaryDataDocumentParser::ReadValue(DataValue& value)
+	{
+		BinaryDataFormat::Tag tag;
+		if (!Read(tag))
+			return false;
+
+		switch (tag)
+		{
+			case BinaryDataFormat::Tag::Null:
+			value.mData.flagsData.flags = DataValue::Flags::Null;
+			return true;
+
+			case BinaryDataFormat::Tag::BoolTrue:
+			value.Set(true);
+			return true;
+
+			case BinaryDataFormat::Tag::BoolFalse:
+			value.Set(false);
+			return true;
+
+			case BinaryDataFormat::Tag::Int:
+			{
+				int data;
+				if (!Read(data))
+					return false;
+
+				value.Set(data);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::UInt:
+			{
+				UInt data;
+				if (!Read(data))
+					return false;
+
+				value.Set(data);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::Int64:
+			{
+				o2::Int64 data;
+				if (!Read(data))
+					return false;
+
+				value.Set(data);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::UInt64:
+			{
+				o2::UInt64 data;
+				if (!Read(data))
+					return false;
+
+				value.Set(data);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::Double:
+			{
+				double data;
+				if (!Read(data))
+					return false;
+
+				value.Set(data);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::String:
+			{
+				const char* string;
+				UInt length;
+				if (!ReadString(string, length))
+					return false;
+
+				value.SetString(string, length, false);
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::Object:
+			return ReadObject(value);
+
+			case BinaryDataFormat::Tag::Array:
+			return ReadArray(value);
+		}
+
+		return false;
+	}
+
+	bool BinaryDataDocumentParser::ReadObject(DataValue& value)
+	{
+		UInt count;
+		if (!Read(count) || count > (mSize - mPosition)/(sizeof(UInt) + 1))
+			return false;
+
+		DataMember* members = nullptr;
+		if (count != 0)
+			members = (DataMember*)document.mAllocator.Allocate(DataValue::GetMembersAllocationSize(count));
+
+		for (UInt i = 0; i < count; i++)
+		{
+			UInt nameIdx;
+			if (!Read(nameIdx) || nameIdx >= (UInt)mNames.Count())
+				return false;
+
+			const Name& name = mNames[nameIdx];
+			new (&members[i].name) DataValue(name.string, name.length, false, document);
+			new (&members[i].value) DataValue(document);
+
+			if (!ReadValue(members[i].value))
+				return false;
+		}
+
+		value.mData.flagsData.flags = DataValue::Flags::Object;
+		value.mData.objectData.members = members;
+		value.mData.objectData.count = count;
+		value.mData.objectData.capacity = count;
+		value.RebuildMembersIndex();
+
+		return true;
+	}
+
+	bool BinaryDataDocumentParser::ReadArray(DataValue& value)
+	{
+		UInt count;
+		if (!Read(count) || count > mSize - mPosition)
+			return false;
+
+		DataValue* elements = nullptr;
+		if (count != 0)
+			elements = (DataValue*)document.mAllocator.Allocate(sizeof(DataValue)*count);
+
+		for (UInt i = 0; i < count; i++)
+		{
+			new (&elements[i]) DataValue(document);
+
+			if (!ReadValue(elements[i]))
+				return false;
+		}
+
+		value.mData.flagsData.flags = DataValue::Flags::Array;
+		value.mData.arrayData.elements = elements;
+		value.mData.arrayData.count = count;
+		value.mData.arrayData.capacity = count;
+
+		return true;
+	}
+
+	template<typename _type>
+	void BinaryDataDocumentWriter::Put(const _type& value)
+	{
+		mBody.append((const char*)&value, sizeof(_type));
+	}
+
+	void BinaryDataDocumentWriter::PutTag(BinaryDataFormat::Tag tag)
+	{
+		mBody.push_back((char)tag);
+	}
+
+	bool BinaryDataDocumentWriter::Null()
+	{
+		PutTag(BinaryDataFormat::Tag::Null);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Bool(bool value)
+	{
+		PutTag(value ? BinaryDataFormat::Tag::BoolTrue : BinaryDataFormat::Tag::BoolFalse);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Int(int value)
+	{
+		PutTag(BinaryDataFormat::Tag::Int);
+		Put(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Uint(unsigned value)
+	{
+		PutTag(BinaryDataFormat::Tag::UInt);
+		Put((UInt)value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Int64(int64_t value)
+	{
+		PutTag(BinaryDataFormat::Tag::Int64);
+		Put((o2::Int64)value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Uint64(uint64_t value)
+	{
+		PutTag(BinaryDataFormat::Tag::UInt64);
+		Put((o2::UInt64)value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Double(double value)
+	{
+		PutTag(BinaryDataFormat::Tag::Double);
+		Put(value);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::String(const char* str, unsigned length, bool copy)
+	{
+		PutTag(BinaryDataFormat::Tag::String);
+		Put((UInt)length);
+		mBody.append(str, length);
+		mBody.push_back('\0');
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::StartObject()
+	{
+		PutTag(BinaryDataFormat::Tag::Object);
+		mCountsPositions.Add(mBody.size());
+		Put((UInt)0);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::Key(const char* str, unsigned length, bool copy)
+	{
+		auto inserted = mNamesIndices.emplace(std::string(str, length), (UInt)mNames.Count());
+		if (inserted.second)
+			mNames.Add(&inserted.first->first);
+
+		Put(inserted.first->second);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::EndObject(unsigned memberCount)
+	{
+		UInt count = memberCount;
+		memcpy(&mBody[mCountsPositions.PopBack()], &count, sizeof(UInt));
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::StartArray()
+	{
+		PutTag(BinaryDataFormat::Tag::Array);
+		mCountsPositions.Add(mBody.size());
+		Put((UInt)0);
+		return true;
+	}
+
+	bool BinaryDataDocumentWriter::EndArray(unsigned elementCount)
+	{
+		UInt count = elementCount;
+		memcpy(&mBody[mCountsPositions.PopBack()], &count, sizeof(UInt));
+		return true;
+	}
+
+	void BinaryDataDocumentWriter::GetResult(o2::String& result) const
+	{
+		size_t namesSize = 0;
+		for (auto name : mNames)
+			namesSize += sizeof(UInt) + name->size() + 1;
+
+		result.clear();
+		result.reserve(BinaryDataFormat::HeaderSize + namesSize + mBody.size());
+
+		auto append = [&](const void* data, size_t size) { result.append((const char*)data, size); };
+
+		UInt version = BinaryDataFormat::Version;
+		UInt namesCount = mNames.Count();
+
+		append(BinaryDataFormat::Signature, sizeof(BinaryDataFormat::Signature));
+		append(&version, sizeof(UInt));
+		append(&namesCount, sizeof(UInt));
+
+		for (auto name : mNames)
+		{
+			UInt length = (UInt)name->size();
+			append(&length, sizeof(UInt));
+			append(name->c_str(), name->size() + 1);
+		}
+
+		append(mBody.data(), mBody.size());
+	}
+}
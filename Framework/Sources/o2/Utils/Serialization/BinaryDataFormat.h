@@ -0,0 +1,119 @@
+#pragma once
+#include "DataValue.h"
+#include <string>
+#include <unordered_map>
+
+namespace o2
+{
+	// Checks that data starts with binary data document signature
+	bool IsBinaryData(const char* data, UInt size);
+
+	// Parses binary document into DataDocument. All strings and member names will be referenced to buffer,
+	// so buffer must live as long as document. Buffer is usually allocated from document's allocator
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document);
+
+	// Writes data into binary string
+	void WriteBinary(String& str, const DataDocument& document);
+
+	// ---------------------------------------------------------------------------------------------
+	// Binary data format description. Layout is little-endian:
+	// header: signature "o2BD", UInt version, UInt names count, names as (UInt length, chars, '\0')
+	// value: Byte tag, then payload by tag. Strings are (UInt length, chars, '\0'), objects are
+	// (UInt count, count*(UInt name index, value)), arrays are (UInt count, count*value)
+	// ---------------------------------------------------------------------------------------------
+	struct BinaryDataFormat
+	{
+		enum class Tag : unsigned char { Null, BoolTrue, BoolFalse, Int, UInt, Int64, UInt64, Double, String, Object, Array };
+
+		static constexpr char Signature[4] = { 'o', '2', 'B', 'D' };
+		static constexpr UInt Version = 1;
+		static constexpr UInt HeaderSize = sizeof(Signature) + sizeof(UInt)*2;
+	};
+
+	// ---------------------------------------------------------------------------------------
+	// Binary data document parser. Builds DataDocument DOM structure directly from buffer, all
+	// members and elements arrays are allocated from document's allocator with exact sizes
+	// ---------------------------------------------------------------------------------------
+	class BinaryDataDocumentParser
+	{
+	public:
+		DataDocument& document;
+
+	public:
+		BinaryDataDocumentParser(char* data, UInt size, DataDocument& document);
+
+		// Parses whole buffer into document. Returns false when data is corrupted
+		bool Parse();
+
+	protected:
+		struct Name
+		{
+			const char* string;
+			UInt        length;
+		};
+
+		char* mData;     // Parsing buffer
+		UInt  mSize;     // Parsing buffer size
+		UInt  mPosition; // Current reading position
+
+		Vector<Name> mNames; // Interned members names table
+
+	protected:
+		// Reads plain value from buffer
+		template<typename _type>
+		bool Read(_type& value);
+
+		// Reads length prefixed null terminated string, returns pointer to buffer
+		bool ReadString(const char*& string, UInt& length);
+
+		// Reads value by tag
+		bool ReadValue(DataValue& value);
+
+		// Reads object members
+		bool ReadObject(DataValue& value);
+
+		// Reads array elements
+		bool ReadArray(DataValue& value);
+	};
+
+	// -----------------------------------------------------------------------------------
+	// Binary data document writer. Receives data from DataValue::Write and builds binary
+	// buffer. Members names are interned into names table
+	// -----------------------------------------------------------------------------------
+	class BinaryDataDocumentWriter
+	{
+	public:
+		bool Null();
+		bool Bool(bool value);
+		bool Int(int value);
+		bool Uint(unsigned value);
+		bool Int64(int64_t value);
+		bool Uint64(uint64_t value);
+		bool Double(double value);
+		bool String(const char* str, unsigned length, bool copy);
+		bool StartObject();
+		bool Key(const char* str, unsigned length, bool copy);
+		bool EndObject(unsigned memberCount);
+		bool StartArray();
+		bool EndArray(unsigned elementCount);
+
+		// Writes header, names table and body into result string
+		void GetResult(o2::String& result) const;
+
+	protected:
+		std::string mBody; // Values data
+
+		std::unordered_map<std::string, UInt> mNamesIndices; // Names indices in table by name
+		Vector<const std::string*>            mNames;        // Names table in order of indices
+
+		Vector<size_t> mCountsPositions; // Stack of opened objects and arrays count positions in body
+
+	protected:
+		// Writes plain value into body
+		template<typename _type>
+		void Put(const _type& value);
+
+		// Writes tag into body
+		void PutTag(BinaryDataFormat::Tag tag);
+	};
+}
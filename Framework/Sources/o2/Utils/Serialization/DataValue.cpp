@@ -2,6 +2,7 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -390,51 +391,53 @@ namespace o2
 
 	DataValue& DataValue::GetMember(const char* name)
 	{
-		DataValue t(name);
-		return GetMember(t);
+		if (auto res = FindMember(name))
+			return *res;
+
+		return AddMember(name);
 	}
 
 	const DataValue& DataValue::GetMember(const char* name) const
 	{
-		return GetMember(DataValue(name));
+		if (auto res = FindMember(name))
+			return *res;
+
+		Assert(false, "Can't find data member");
+
+		static DataValue empty;
+		return empty;
 	}
 
 	DataValue* DataValue::FindMember(const DataValue& name)
 	{
-		if (!IsObject())
-			return nullptr;
-
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
-		{
-			if (memberIt->name == name)
-				return &memberIt->value;
-		}
+		if (auto member = FindDataMember(name))
+			return &member->value;
 
 		return nullptr;
 	}
 
 	const DataValue* DataValue::FindMember(const DataValue& name) const
 	{
-		if (!IsObject())
-			return nullptr;
-
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
-		{
-			if (memberIt->name == name)
-				return &memberIt->value;
-		}
+		if (auto member = FindDataMember(name))
+			return &member->value;
 
 		return nullptr;
 	}
 
 	DataValue* DataValue::FindMember(const char* name)
 	{
-		return FindMember(DataValue(name));
+		if (auto member = FindMemberByName(name, strlen(name)))
+			return &member->value;
+
+		return nullptr;
 	}
 
 	const DataValue* DataValue::FindMember(const char* name) const
 	{
-		return FindMember(DataValue(name));
+		if (auto member = FindMemberByName(name, strlen(name)))
+			return &member->value;
+
+		return nullptr;
 	}
 
 	DataValue& DataValue::AddMember(DataValue& name)
@@ -442,28 +445,27 @@ namespace o2
 		if (!IsObject())
 		{
 			mData.flagsData.flags = Flags::Object;
-
-			mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
-			mData.objectData.capacity = ObjectInitialCapacity;
+			mData.objectData.members = nullptr;
+			mData.objectData.capacity = 0;
 			mData.objectData.count = 0;
 		}
 
+		bool capacityChanged = false;
 		if (mData.objectData.count == mData.objectData.capacity)
 		{
+			UInt newCapacity = Math::Max(mData.objectData.capacity*2, ObjectInitialCapacity);
+
 			if (mData.objectData.members)
 			{
-				UInt newCapacity = Math::Max(mData.objectData.capacity*2, ObjectInitialCapacity);
 				mData.objectData.members = (DataMember*)mDocument->mAllocator.Reallocate(
-					mData.objectData.members, sizeof(DataMember)*mData.objectData.capacity,
-					sizeof(DataMember)*newCapacity);
-
-				mData.objectData.capacity = newCapacity;
+					mData.objectData.members, GetMembersAllocationSize(mData.objectData.capacity),
+					GetMembersAllocationSize(newCapacity));
 			}
 			else
-			{
-				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(sizeof(DataMember)*ObjectInitialCapacity);
-				mData.objectData.capacity = ObjectInitialCapacity;
-			}
+				mData.objectData.members = (DataMember*)mDocument->mAllocator.Allocate(GetMembersAllocationSize(newCapacity));
+
+			mData.objectData.capacity = newCapacity;
+			capacityChanged = true;
 		}
 
 		DataMember* newMember =
@@ -471,6 +473,12 @@ namespace o2
 
 		mData.objectData.count++;
 
+		// Index is placed after members, so it must be rebuilt after reallocation
+		if (capacityChanged)
+			RebuildMembersIndex();
+		else if (mData.flagsData.Is(Flags::ObjectIndexed))
+			AddMemberToIndex(mData.objectData.count - 1);
+
 		return newMember->value;
 	}
 
@@ -484,14 +492,8 @@ namespace o2
 	{
 		Assert(IsObject(), "Trying remove member, but value isn't object");
 
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
-		{
-			if (memberIt->name == name)
-			{
-				*memberIt = *(mData.objectData.members + mData.objectData.count - 1);
-				mData.objectData.count--;
-			}
-		}
+		if (auto member = FindDataMember(name))
+			RemoveMember(DataMemberIterator(member));
 	}
 
 	DataMemberIterator DataValue::RemoveMember(DataMemberIterator it)
@@ -502,12 +504,140 @@ namespace o2
 		*it = *(mData.objectData.members + mData.objectData.count - 1);
 		mData.objectData.count--;
 
+		if (mData.flagsData.Is(Flags::ObjectIndexed))
+			RebuildMembersIndex();
+
 		return it;
 	}
 
 	void DataValue::RemoveMember(const char* name)
 	{
-		RemoveMember(DataValue(name));
+		Assert(IsObject(), "Trying remove member, but value isn't object");
+
+		if (auto member = FindMemberByName(name, strlen(name)))
+			RemoveMember(DataMemberIterator(member));
+	}
+
+	size_t DataValue::GetMembersAllocationSize(UInt capacity)
+	{
+		return sizeof(DataMember)*capacity + sizeof(MemberIndexSlot)*GetMembersIndexSlotsCount(capacity);
+	}
+
+	UInt DataValue::GetMembersIndexSlotsCount(UInt capacity)
+	{
+		if (capacity < ObjectIndexMinCapacity)
+			return 0;
+
+		// Power of two with load factor not greater than half
+		UInt slotsCount = 1;
+		while (slotsCount < capacity*2)
+			slotsCount <<= 1;
+
+		return slotsCount;
+	}
+
+	UInt DataValue::GetMemberNameHash(const char* name, size_t length)
+	{
+		UInt hash = 2166136261u;
+		for (size_t i = 0; i < length; i++)
+		{
+			hash ^= (unsigned char)name[i];
+			hash *= 16777619u;
+		}
+
+		return hash;
+	}
+
+	DataValue::MemberIndexSlot* DataValue::GetMembersIndex() const
+	{
+		return (MemberIndexSlot*)(mData.objectData.members + mData.objectData.capacity);
+	}
+
+	void DataValue::RebuildMembersIndex()
+	{
+		UInt slotsCount = GetMembersIndexSlotsCount(mData.objectData.capacity);
+		if (slotsCount == 0)
+		{
+			mData.flagsData.flags = Flags::Object;
+			return;
+		}
+
+		mData.flagsData.flags = Flags::Object | Flags::ObjectIndexed;
+		memset(GetMembersIndex(), 0, sizeof(MemberIndexSlot)*slotsCount);
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+			AddMemberToIndex(i);
+	}
+
+	void DataValue::AddMemberToIndex(UInt idx)
+	{
+		const DataValue& name = mData.objectData.members[idx].name;
+		if (!name.IsString())
+			return;
+
+		UInt hash = GetMemberNameHash(name.GetString(), name.GetStringLength());
+		UInt mask = GetMembersIndexSlotsCount(mData.objectData.capacity) - 1;
+		MemberIndexSlot* index = GetMembersIndex();
+
+		UInt slot = hash & mask;
+		while (index[slot].memberIdx != 0)
+			slot = (slot + 1) & mask;
+
+		index[slot].hash = hash;
+		index[slot].memberIdx = idx + 1;
+	}
+
+	DataMember* DataValue::FindMemberByName(const char* name, size_t length) const
+	{
+		if (!IsObject())
+			return nullptr;
+
+		DataMember* members = mData.objectData.members;
+
+		auto isNameEquals = [&](const DataMember& member) {
+			return member.name.IsString() && member.name.GetStringLength() == length &&
+				memcmp(member.name.GetString(), name, length) == 0;
+		};
+
+		if (mData.flagsData.Is(Flags::ObjectIndexed))
+		{
+			UInt hash = GetMemberNameHash(name, length);
+			UInt mask = GetMembersIndexSlotsCount(mData.objectData.capacity) - 1;
+			MemberIndexSlot* index = GetMembersIndex();
+
+			for (UInt slot = hash & mask; index[slot].memberIdx != 0; slot = (slot + 1) & mask)
+			{
+				if (index[slot].hash == hash && isNameEquals(members[index[slot].memberIdx - 1]))
+					return &members[index[slot].memberIdx - 1];
+			}
+
+			return nullptr;
+		}
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+		{
+			if (isNameEquals(members[i]))
+				return &members[i];
+		}
+
+		return nullptr;
+	}
+
+	DataMember* DataValue::FindDataMember(const DataValue& name) const
+	{
+		if (!IsObject())
+			return nullptr;
+
+		if (name.IsString())
+			return FindMemberByName(name.GetString(), name.GetStringLength());
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+		{
+			if (mData.objectData.members[i].name == name)
+				return &mData.objectData.members[i];
+		}
+
+		return nullptr;
 	}
 
 	DataMemberIterator DataValue::BeginMember()
@@ -776,7 +906,12 @@ namespace o2
 	void DataValue::Clear()
 	{
 		if (IsObject())
+		{
 			mData.objectData.count = 0;
+
+			if (mData.flagsData.Is(Flags::ObjectIndexed))
+				RebuildMembersIndex();
+		}
 		else if (IsArray())
 			mData.arrayData.count = 0;
 		else
@@ -830,8 +965,13 @@ namespace o2
 			return false;
 
 		auto size = file.GetDataSize();
-		char* data = (char*)mAllocator.Allocate(size);
+		char* data = (char*)mAllocator.Allocate(size + 1);
 		file.ReadData(data, size);
+		data[size] = '\0';
+
+		// Binary data is detected by signature, so built binary assets are loaded by same code as json
+		if (IsBinaryData(data, size))
+			return ParseBinaryInplace(data, size, *this);
 
 		if (format == Format::JSON)
 			return ParseJsonInplace(data, *this);
@@ -841,6 +981,13 @@ namespace o2
 
 	bool DataDocument::LoadFromData(const String& data, Format format /*= Format::JSON*/)
 	{
+		if (format == Format::Binary || IsBinaryData(data.Data(), data.Length()))
+		{
+			char* buffer = (char*)mAllocator.Allocate(data.Length());
+			memcpy(buffer, data.Data(), data.Length());
+			return ParseBinaryInplace(buffer, data.Length(), *this);
+		}
+
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
@@ -857,7 +1004,7 @@ namespace o2
 
 		file.WriteData(data.Data(), data.Length());
 
-		return false;
+		return true;
 	}
 
 	String DataDocument::SaveAsString(Format format /*= Format::JSON*/) const
@@ -869,6 +1016,13 @@ namespace o2
 			return buf;
 		}
 
+		if (format == Format::Binary)
+		{
+			String buf;
+			WriteBinary(buf, *this);
+			return buf;
+		}
+
 		return "";
 		//return XmlDataFormat::SaveDataDoc(*this);
 	}
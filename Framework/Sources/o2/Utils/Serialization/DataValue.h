@@ -289,7 +289,9 @@ namespace o2
 
 			ShortString = 1 << 13,
 			StringRef = 1 << 14,
-			StringCopy = 1 << 15
+			StringCopy = 1 << 15,
+
+			ObjectIndexed = 1 << 16
 		};
 
 	protected:
@@ -299,6 +301,8 @@ namespace o2
 		static constexpr UInt ObjectInitialCapacity = 7;
 		static constexpr UInt ArrayInitialCapacity = 7;
 
+		static constexpr UInt ObjectIndexMinCapacity = 16; // Objects with smaller capacity are searched linearly
+
 		struct IntData
 		{
 			int intValue;
@@ -358,6 +362,13 @@ namespace o2
 			UInt capacity;
 		};
 
+		// Object members hash index slot. Index is placed in same allocation right after members
+		struct MemberIndexSlot
+		{
+			UInt hash;      // Precomputed member name hash
+			UInt memberIdx; // Member index + 1, zero for empty slot
+		};
+
 		union ValueData
 		{
 			IntData         intData;
@@ -387,6 +398,31 @@ namespace o2
 		// Transcode char to wide char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF16<>>& target, const char* source);
 
+		// Returns size of members allocation with hash index for capacity
+		static size_t GetMembersAllocationSize(UInt capacity);
+
+		// Returns count of members hash index slots for capacity. Returns zero when object is too small for indexing
+		static UInt GetMembersIndexSlotsCount(UInt capacity);
+
+		// Returns hash of member name
+		static UInt GetMemberNameHash(const char* name, size_t length);
+
+		// Returns members hash index
+		MemberIndexSlot* GetMembersIndex() const;
+
+		// Rebuilds members hash index, or disables it when capacity is too small
+		void RebuildMembersIndex();
+
+		// Puts member into hash index
+		void AddMemberToIndex(UInt idx);
+
+		// Searches member by name string. Uses hash index when it is built
+		DataMember* FindMemberByName(const char* name, size_t length) const;
+
+		// Searches member by name value
+		DataMember* FindDataMember(const DataValue& name) const;
+
+		friend class BinaryDataDocumentParser;
 		friend class JsonDataDocumentParseHandler;
 		friend class TType<DataValue>;
 	};
@@ -447,6 +483,7 @@ namespace o2
 	protected:
 		ChunkPoolAllocator mAllocator;
 
+		friend class BinaryDataDocumentParser;
 		friend class DataValue;
 		friend class JsonDataDocumentParseHandler;
 	};
@@ -1331,6 +1368,12 @@ namespace o2
 						WriteObject(baseObject, *baseObjectType, node);
 					}
 
+					if (auto serializeFunc = type.GetSerializeFieldsFunc())
+					{
+						(*serializeFunc)(object, node);
+						return;
+					}
+
 					for (auto& field : type.GetFields())
 					{
 						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
@@ -1365,6 +1408,12 @@ namespace o2
 						ReadObject(baseObject, *baseObjectType, node);
 					}
 
+					if (auto deserializeFunc = type.GetDeserializeFieldsFunc())
+					{
+						(*deserializeFunc)(object, node);
+						return;
+					}
+
 					for (auto& field : type.GetFields())
 					{
 						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
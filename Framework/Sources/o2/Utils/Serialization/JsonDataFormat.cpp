@@ -123,7 +123,7 @@ namespace o2
 		if (memberCount != 0)
 		{
 			size_t size = sizeof(DataMember)*memberCount;
-			top->mData.objectData.members = (DataMember*)document.mAllocator.Allocate(size);
+			top->mData.objectData.members = (DataMember*)document.mAllocator.Allocate(DataValue::GetMembersAllocationSize(memberCount));
 			memcpy(top->mData.objectData.members, members, size);
 		}
 		else
@@ -131,6 +131,7 @@ namespace o2
 
 		top->mData.objectData.count = memberCount;
 		top->mData.objectData.capacity = memberCount;
+		top->RebuildMembersIndex();
 
 		return true;
 	}
@@ -59,6 +59,83 @@ namespace o2
 		ATTRIBUTE_SHORT_DEFINITION("SERIALIZABLE_ATTRIBUTE");
 	};
 
+	// ------------------------------------------------------------------------------------------
+	// Generated serializable fields writer. Used by CodeTool generated CLASS_SERIALIZATION_META,
+	// writes fields directly without reflection fields iteration. Skips default values same as
+	// reflection based serialization
+	// ------------------------------------------------------------------------------------------
+	struct FieldsSerializer
+	{
+		DataValue& node; // Object data node
+
+	public:
+		// Constructor
+		FieldsSerializer(DataValue& node): node(node) {}
+
+		// Writes field if it isn't default
+		template<typename T>
+		void Field(const char* name, const T& value)
+		{
+			if constexpr (DataValue::IsSupports<T>::value)
+			{
+				if constexpr (std::is_default_constructible<T>::value && SupportsEqualOperator<T>::value)
+				{
+					if (Math::Equals(value, T()))
+						return;
+				}
+
+				node.AddMember(name).Set(value);
+			}
+		}
+
+		// Writes field if it isn't equals to default value. Default value getter returns value evaluated once
+		template<typename T, typename _default_getter>
+		void FieldWithDefault(const char* name, const T& value, const _default_getter& defaultGetter)
+		{
+			if constexpr (DataValue::IsSupports<T>::value)
+			{
+				typedef std::decay_t<decltype(defaultGetter())> _default_type;
+				if constexpr (SupportsEqualOperatorWith<T, _default_type>::value)
+				{
+					if (value == defaultGetter())
+						return;
+				}
+
+				node.AddMember(name).Set(value);
+			}
+		}
+	};
+
+	// -----------------------------------------------------------------------------------------
+	// Generated serializable fields reader. Used by CodeTool generated CLASS_SERIALIZATION_META
+	// -----------------------------------------------------------------------------------------
+	struct FieldsDeserializer
+	{
+		const DataValue& node; // Object data node
+
+	public:
+		// Constructor
+		FieldsDeserializer(const DataValue& node): node(node) {}
+
+		// Reads field if it is in data
+		template<typename T>
+		void Field(const char* name, T& value)
+		{
+			if constexpr (DataValue::IsSupports<T>::value)
+			{
+				if (auto fieldNode = node.FindMember(name))
+					fieldNode->Get(value);
+			}
+		}
+
+		// Reads field if it is in data. Default value is used only by serializer, getter isn't called
+		template<typename T, typename _default_getter>
+		void FieldWithDefault(const char* name, T& value, const _default_getter& defaultGetter)
+		{
+			Field(name, value);
+		}
+	};
+
 	// Serialization implementation macros
 #define SERIALIZABLE_MAIN(CLASS)  							                                                    \
     IOBJECT_MAIN(CLASS)																							\
@@ -87,13 +164,34 @@ namespace o2
 		                                                                                                        \
     template<typename _type_processor> static void ProcessBaseTypes(CLASS* object, _type_processor& processor); \
     template<typename _type_processor> static void ProcessFields(CLASS* object, _type_processor& processor);    \
-    template<typename _type_processor> static void ProcessMethods(CLASS* object, _type_processor& processor);   
+    template<typename _type_processor> static void ProcessMethods(CLASS* object, _type_processor& processor);   \
+                                                                                                                \
+    template<typename _serializer> static void ProcessSerializableFields(CLASS* object, _serializer& serializer);\
+    static bool serializationFieldsRegistered;
 
 #define SERIALIZABLE_MANUAL(CLASS) \
     SERIALIZABLE(CLASS)
 
 #define SERIALIZABLE_ATTRIBUTE() \
     AddAttribute(new SerializableAttribute())
+
+	// Generated serialization functions macros
+#define CLASS_SERIALIZATION_META(CLASS)                                                                           \
+    bool CLASS::serializationFieldsRegistered = o2::TypeInitializer::RegSerializationFields(CLASS::type,           \
+        [](void* object, o2::DataValue& node) { o2::FieldsSerializer serializer(node);                           \
+                                                CLASS::ProcessSerializableFields((CLASS*)object, serializer); },  \
+        [](void* object, const o2::DataValue& node) { o2::FieldsDeserializer serializer(node);                   \
+                                                      CLASS::ProcessSerializableFields((CLASS*)object, serializer); }); \
+                                                                                                                  \
+    template<typename _serializer> void CLASS::ProcessSerializableFields(CLASS* object, _serializer& serializer)   \
+	{                                                                                                             \
+        typedef CLASS thisclass;
+
+#define SERIALIZABLE_FIELD(NAME) \
+    serializer.Field(#NAME, object->NAME)
+
+#define SERIALIZABLE_FIELD_DEFAULT(NAME, ...) \
+    serializer.FieldWithDefault(#NAME, object->NAME, []() -> const auto& { static const auto defaultValue = __VA_ARGS__; return defaultValue; })
 }
 
 CLASS_BASES_META(o2::ISerializable)
@@ -73,3 +73,11 @@ namespace o2
 }
 
 DECLARE_CLASS(o2::ShortcutKeys);
+CLASS_SERIALIZATION_META(o2::ShortcutKeys)
+{
+	SERIALIZABLE_FIELD(control);
+	SERIALIZABLE_FIELD(shift);
+	SERIALIZABLE_FIELD(alt);
+	SERIALIZABLE_FIELD(key);
+}
+END_META;
@@ -2,3 +2,13 @@
 #include "TimeStamp.h"
 
 DECLARE_CLASS(o2::TimeStamp);
+CLASS_SERIALIZATION_META(o2::TimeStamp)
+{
+	SERIALIZABLE_FIELD(mYear);
+	SERIALIZABLE_FIELD(mMonth);
+	SERIALIZABLE_FIELD(mDay);
+	SERIALIZABLE_FIELD(mHour);
+	SERIALIZABLE_FIELD(mMinute);
+	SERIALIZABLE_FIELD(mSecond);
+}
+END_META;
@@ -0,0 +1,145 @@
+#include "o2/stdafx.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <memory>
+
+namespace o2
+{
+	ThreadPool& ThreadPool::Instance()
+	{
+		static ThreadPool instance;
+		return instance;
+	}
+
+	ThreadPool::ThreadPool():
+		mStopped(false)
+	{
+		int workersCount = Math::Max((int)std::thread::hardware_concurrency() - 1, 1);
+		for (int i = 0; i < workersCount; i++)
+			mWorkers.Add(mnew std::thread(&ThreadPool::WorkerThread, this));
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mStopped = true;
+		}
+
+		mJobsCV.notify_all();
+
+		for (auto worker : mWorkers)
+		{
+			worker->join();
+			delete worker;
+		}
+	}
+
+	int ThreadPool::GetWorkersCount() const
+	{
+		return mWorkers.Count();
+	}
+
+	void ThreadPool::Run(const Function<void()>& job)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mJobs.push_back(job);
+		}
+
+		mJobsCV.notify_one();
+	}
+
+	void ThreadPool::ParallelFor(int count, const Function<void(int)>& func)
+	{
+		if (count <= 0)
+			return;
+
+		if (count == 1 || mWorkers.IsEmpty())
+		{
+			for (int i = 0; i < count; i++)
+				func(i);
+
+			return;
+		}
+
+		// State is shared with helper jobs, they can start after this call is finished
+		struct State
+		{
+			const Function<void(int)>* func;
+			int                        count;
+			std::atomic<int>           next { 0 };
+			std::atomic<int>           done { 0 };
+			std::mutex                 mutex;
+			std::condition_variable    doneCV;
+		};
+
+		auto state = std::make_shared<State>();
+		state->func = &func;
+		state->count = count;
+
+		auto process = [](State& state)
+		{
+			int processed = 0;
+			for (int i = state.next++; i < state.count; i = state.next++)
+			{
+				(*state.func)(i);
+				processed++;
+			}
+
+			if (processed > 0 && (state.done += processed) == state.count)
+			{
+				std::unique_lock<std::mutex> lock(state.mutex);
+				state.doneCV.notify_all();
+			}
+		};
+
+		int helpersCount = Math::Min(mWorkers.Count(), count - 1);
+		for (int i = 0; i < helpersCount; i++)
+			Run([=]() { process(*state); });
+
+		process(*state);
+
+		std::unique_lock<std::mutex> lock(state->mutex);
+		state->doneCV.wait(lock, [&]() { return state->done == count; });
+	}
+
+	void ThreadPool::ParallelForRanges(int count, int minRangeSize, const Function<void(int, int)>& func)
+	{
+		if (count <= 0)
+			return;
+
+		int rangesCount = Math::Clamp(count/Math::Max(minRangeSize, 1), 1, mWorkers.Count() + 1);
+		int rangeSize = (count + rangesCount - 1)/rangesCount;
+
+		ParallelFor(rangesCount, [&](int idx) {
+			int begin = idx*rangeSize;
+			int end = Math::Min(begin + rangeSize, count);
+
+			if (begin < end)
+				func(begin, end);
+		});
+	}
+
+	void ThreadPool::WorkerThread()
+	{
+		while (true)
+		{
+			Function<void()> job;
+
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mJobsCV.wait(lock, [&]() { return mStopped || !mJobs.empty(); });
+
+				if (mStopped && mJobs.empty())
+					return;
+
+				job = mJobs.front();
+				mJobs.pop_front();
+			}
+
+			job();
+		}
+	}
+}
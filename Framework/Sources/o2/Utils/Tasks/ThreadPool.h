@@ -0,0 +1,55 @@
+#pragma once
+
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Thread pool access macros
+#define o2ThreadPool o2::ThreadPool::Instance()
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Pool of worker threads for data parallel and background jobs. Workers are created at first use.
+	// Parallel for: calling thread takes part in execution and returns when all indices are processed
+	// -----------------------------------------------------------------------------------------------
+	class ThreadPool
+	{
+	public:
+		// Returns pool instance, creates it at first call
+		static ThreadPool& Instance();
+
+		// Returns count of worker threads
+		int GetWorkersCount() const;
+
+		// Runs job on worker thread
+		void Run(const Function<void()>& job);
+
+		// Calls func for each index in [0, count) in parallel. Blocks until all indices are processed
+		void ParallelFor(int count, const Function<void(int)>& func);
+
+		// Splits [0, count) into ranges not less than minRangeSize and calls func(begin, end) for each range in parallel.
+		// Blocks until all ranges are processed
+		void ParallelForRanges(int count, int minRangeSize, const Function<void(int, int)>& func);
+
+	protected:
+		Vector<std::thread*>              mWorkers; // Worker threads
+		std::deque<Function<void()>>      mJobs;    // Queued jobs
+		std::mutex                        mMutex;   // Jobs queue mutex
+		std::condition_variable           mJobsCV;  // Jobs queue condition, notifies workers about new jobs
+		bool                              mStopped; // Is pool stopping, workers exits when true
+
+	protected:
+		// Default constructor. Creates workers by hardware concurrency
+		ThreadPool();
+
+		// Destructor. Stops and joins workers
+		~ThreadPool();
+
+		// Worker thread function
+		void WorkerThread();
+	};
+}